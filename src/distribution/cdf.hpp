@@ -9,7 +9,10 @@
 */
 # pragma	once
 # include	<cmath>
+# include	<thread>
+# include	<random>
 # include	"raw.hpp"
+# include	"../observations/sample.hpp"
 # include	"../models/discrete/uniform.hpp"
 # include	"../models/discrete/bernoulli.hpp"
 # include	"../models/discrete/geometric.hpp"
@@ -29,6 +32,20 @@
 # include	"../models/continuous/normal.hpp"
 # include	"../models/continuous/laplace.hpp"
 # include	"../models/continuous/asymmetric_laplace.hpp"
+# include	"../models/continuous/likelihood.hpp"
+# include	"../models/continuous/mixture.hpp"
+
+// Bootstrap replicates every thread computes in one round
+# define	BOOTSTRAP_BLOCK		32
+
+// Minimal count of bootstrap replicates before the early stop is checked
+# define	BOOTSTRAP_MIN		100
+
+// Z-score of the early stop decision (about 99.9% two-sided certainty)
+# define	BOOTSTRAP_Z			3.29
+
+// Largest sample size the exact Kolmogorov distribution is computed for
+# define	KOLMOGOROV_EXACT	2000
 
 //****************************************************************************//
 //      Class "KolmogorovScore"                                               //
@@ -80,6 +97,10 @@ class CDF
 private:
 	RawCDF sample;							// Sample CDF to compare
 	RawCDF reference;						// Reference CDF
+	vector <double> lower;					// Left limits of the reference CDF at the sample values
+	size_t observations;					// Count of observations in the sample
+	size_t references;						// Count of observations in the reference sample
+	bool continuous;						// The reference is a continuous model
 
 //============================================================================//
 //      Private methods                                                       //
@@ -93,11 +114,12 @@ private:
 	void TestModel (
 		KolmogorovScoreTable &table,		// Score table
 		const Observations &data,			// Observations of a random value
-		const string name					// Distribution model name
+		const string name,					// Distribution model name
+		Model::Likelihood::EstimatorType estimator	// Estimator of the model parameters
 	)
 	try {
 		// Set the distribution model
-		ReferenceModel (T (data));
+		ReferenceModel (Model::Likelihood::Estimate <T> (data, estimator));
 
 		// Try to estimate the confidence level of the one-sample Kolmogorov-Smirnov test
 		const double level = KolmogorovConfidenceLevel();
@@ -106,6 +128,64 @@ private:
 
 	} catch (const invalid_argument &exception) {}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Perform a bootstrap test of a distribution model                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void BootstrapTestModel (
+		KolmogorovScoreTable &table,		// Score table
+		const Observations &data,			// Observations of a random value
+		const string name,					// Distribution model name
+		size_t replicates,					// Count of bootstrap replicates
+		double alpha,						// Rejection level for the early stop
+		size_t seed,						// The seed value
+		Model::Likelihood::EstimatorType estimator	// Estimator of the model parameters
+	)
+	try {
+		// Try to estimate the confidence level of the parametric bootstrap test
+		const double level = KolmogorovBootstrapLevel <T> (data, replicates, alpha, seed, estimator);
+		if (!isnan (level))
+			table.push_back (KolmogorovScore {name, level});
+
+	} catch (const invalid_argument &exception) {}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Perform a bootstrap test of a distribution model with the range check //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static void BootstrapTestModelWithRange (
+		KolmogorovScoreTable &table,		// Score table
+		const Observations &data,			// Observations of a random value
+		const string name,					// Distribution model name
+		size_t replicates,					// Count of bootstrap replicates
+		double alpha,						// Rejection level for the early stop
+		size_t seed,						// The seed value
+		Model::Likelihood::EstimatorType estimator	// Estimator of the model parameters
+	)
+	try {
+		if (T::InDomain (data.Domain()))
+			BootstrapTestModel <T> (table, data, name, replicates, alpha, seed, estimator);
+	} catch (const invalid_argument &exception) {}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Compute the statistic of a bootstrap replicate                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static double BootstrapCriteria (
+		T &model,							// Fitted distribution model
+		size_t size,						// Size of the sample to generate
+		double seed,						// The seed value
+		Model::Likelihood::EstimatorType estimator	// Estimator of the model parameters
+	){
+		// Generate a new sample from the fitted model
+		const ::Sample data (model.Generate (size, seed));
+
+		// Refit the model to the generated sample by the same estimator and test it
+		CDF test (data);
+		test.ReferenceModel (Model::Likelihood::Estimate <T> (data, estimator));
+		return test.KolmogorovCriteria1();
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Perform a test of a distribution model with the range validation      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -113,32 +193,49 @@ private:
 	void TestModelWithRange (
 		KolmogorovScoreTable &table,		// Score table
 		const Observations &data,			// Observations of a random value
-		const string name					// Distribution model name
+		const string name,					// Distribution model name
+		Model::Likelihood::EstimatorType estimator	// Estimator of the model parameters
 	)
 	try {
 		if (T::InDomain (data.Domain()))
-			TestModel <T> (table, data, name);
+			TestModel <T> (table, data, name, estimator);
 	} catch (const invalid_argument &exception) {}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-//      Compute the value of the one-sample Kolmogorov-Smirnov test           //
+//      Supremum between the sample CDF and the reference CDF                 //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	double KolmogorovCriteria1 (void) const {
+// NOTE:	The sample CDF jumps at every sample value, so the supremum is
+//			checked on both sides of the jumps. The upper side compares the
+//			reference CDF with the sample CDF at the value (D+), the lower
+//			one compares the left limit of the reference CDF with the sample
+//			CDF at the previous value (D-)
+	double KolmogorovStatistic1 (void) const {
 
-		// Get both CDF functions
+		// Get both CDF functions and the left limits of the reference one
 		const vector <double> &src = sample.CDF();
 		const vector <double> &ref = reference.CDF();
+		const vector <double> &left = lower.size() == ref.size() ? lower : ref;
 
 		// Find the supremum between two CDFs
 		double max_diff = 0.0;
+		double prev = 0.0;
 		const size_t size = src.size();
 		for (size_t i = 0; i < size; i++) {
-			const double diff = abs (src[i] - ref[i]);
+			const double diff = max (abs (src[i] - ref[i]), abs (left[i] - prev));
 			if (max_diff < diff) max_diff = diff;
+			prev = src[i];
 		}
+		return max_diff;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Compute the value of the one-sample Kolmogorov-Smirnov test           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double KolmogorovCriteria1 (void) const {
 
 		// Calculate the criteria function with the correction value
-		const double criteria = sqrt (size) * max_diff;
+		const size_t size = observations;
+		const double criteria = sqrt (size) * KolmogorovStatistic1();
 		return criteria + 1.0 / (6.0 * sqrt (size)) + 0.25 * (criteria - 1.0) / size;
 	}
 
@@ -157,18 +254,21 @@ private:
 		auto last = unique (values.begin(), values.end());
 		values.erase (last, values.end());
 
+		// Both CDFs for the sorted values are found by the merge walk
+		const vector <double> &cdf1 = sample.GetCDF (values);
+		const vector <double> &cdf2 = reference.GetCDF (values);
+
 		// Find the supremum between two CDFs
 		double max_diff = 0.0;
 		const size_t size = values.size();
 		for (size_t i = 0; i < size; i++) {
-			const double x = values[i];
-			const double diff = abs (sample.GetCDF (x) - reference.GetCDF (x));
+			const double diff = abs (cdf1[i] - cdf2[i]);
 			if (max_diff < diff) max_diff = diff;
 		}
 
 		// Calculate the criteria function
-		const size_t size1 = sample.Size();
-		const size_t size2 = reference.Size();
+		const size_t size1 = observations;
+		const size_t size2 = references;
 		return sqrt (size1 * size2 / double (size1 + size2)) * max_diff;
 	}
 
@@ -180,6 +280,12 @@ private:
 		// Use shortenings
 		using namespace Model;
 
+		// Small samples of continuous models use the exact distribution of
+		// the statistic, which does not hold for ties of discrete models
+		const size_t size = observations;
+		if (continuous && size <= KOLMOGOROV_EXACT)
+			return 1.0 - Kolmogorov::FiniteCDF (size, KolmogorovStatistic1());
+
 		// Compute the value of the one-sample Kolmogorov-Smirnov test
 		const double criteria = KolmogorovCriteria1();
 
@@ -198,6 +304,12 @@ private:
 		// Use shortenings
 		using namespace Model;
 
+		// Small samples of continuous models use the exact distribution of
+		// the statistic, which does not hold for ties of discrete models
+		const size_t size = observations;
+		if (continuous && size <= KOLMOGOROV_EXACT)
+			return Kolmogorov::FiniteCDF (size, KolmogorovStatistic1()) <= alpha;
+
 		// Compute the value of the one-sample Kolmogorov-Smirnov test
 		const double criteria = KolmogorovCriteria1 ();
 
@@ -238,14 +350,22 @@ public:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Constructors from empirical data                                      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The weights of the observations are counts of the values, so the
+//			tests take the sum of the weights as the count of observations
 	CDF (
 		const Observations &data			// Observations of a random value
-	) : sample (data)
+	) : sample (data),
+		observations (max (size_t (round (data.TotalWeight())), size_t (1))),
+		references (0),
+		continuous (false)
 	{}
 
 	CDF (
 		const vector <double> &data			// Empirical data
-	) : sample (move (vector <double> (data)))
+	) : sample (move (vector <double> (data))),
+		observations (data.size()),
+		references (0),
+		continuous (false)
 	{}
 
 	CDF (
@@ -335,19 +455,44 @@ public:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Load a CDF model as a reference for the distribution test             //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
 	void ReferenceModel (
-		const Model::BaseModel &model		// Theoretical model
+		const T &model						// Theoretical model
 	){
 		// Check if empirical data range is inside the model domain
 		if (model.Domain() >= sample.Domain()) {
 
 			// Set the CDF model
 			reference = RawCDF (model, sample.Values());
+			const Model::BaseModel *base = &model;
+			continuous = dynamic_cast <const Model::BaseDiscrete*> (base) == NULL;
+
+			// The left limits of a discrete CDF drop the mass of the value
+			lower = reference.CDF();
+			if (!continuous) {
+				const vector <double> &values = sample.Values();
+				for (size_t i = 0; i < lower.size(); i++)
+					lower[i] = max (lower[i] - model.PDF (values[i]), 0.0);
+			}
 		}
 		else
 			throw invalid_argument ("ReferenceModel: The sample data range is outside the distribution model domain");
 	}
 
+	// Any distribution
+	void ReferenceModel (
+		const Model::BaseModel &model		// Theoretical model
+	){
+		ReferenceModel <Model::BaseModel> (model);
+	}
+
+	// Discrete distribution
+	void ReferenceModel (
+		const Model::BaseDiscrete &model	// Theoretical model
+	){
+		ReferenceModel <Model::BaseDiscrete> (model);
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Load another sample as a reference for the distribution test          //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -355,12 +500,18 @@ public:
 		const Observations &data			// Observations of a random value
 	){
 		reference = RawCDF (data);
+		lower.clear();
+		references = max (size_t (round (data.TotalWeight())), size_t (1));
+		continuous = false;
 	}
 
 	void ReferenceSample (
 		const vector <double> &data			// Empirical data
 	){
 		reference = RawCDF (move (vector <double> (data)));
+		lower.clear();
+		references = data.size();
+		continuous = false;
 	}
 
 	void ReferenceSample (
@@ -403,6 +554,99 @@ public:
 			throw invalid_argument ("KolmogorovConfidenceLevel: Set a sample and a reference for the confidence level");
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Confidence level of the parametric bootstrap (Lilliefors) test        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The model parameters are estimated from the same data it is tested
+//			against, so the plain Kolmogorov level is too optimistic. Instead
+//			the statistic is compared with its own distribution obtained by
+//			generating samples from the fitted model and refitting the model
+//			to every one of them. Replicates run in parallel on all the cores
+//			with an independent random stream per thread. Every replicate is
+//			refitted by the same estimator as the original data and has as
+//			many observations as the original data counts by their weights.
+//			If alpha is not zero, then the bootstrap stops as soon as the
+//			confidence level is certainly above or below alpha.
+	template <typename T>
+	static double KolmogorovBootstrapLevel (
+		const Observations &data,			// Observations of a random value
+		size_t replicates,					// Count of bootstrap replicates
+		double alpha,						// Rejection level for the early stop
+		size_t seed,						// The seed value
+		Model::Likelihood::EstimatorType estimator	// Estimator of the model parameters
+	){
+		// Check if the level is correct
+		if (alpha < 0.0 || alpha > 1.0)
+			throw invalid_argument ("KolmogorovBootstrapLevel: The rejection level must be in the range [0..1]");
+
+		// Fit the model and compute the statistic for the original data
+		const T model (Model::Likelihood::Estimate <T> (data, estimator));
+		CDF temp (data);
+		temp.ReferenceModel (model);
+		const double criteria = temp.KolmogorovCriteria1();
+		const size_t size = temp.observations;
+
+		// Independent random streams for every thread
+		const size_t threads = max (thread::hardware_concurrency(), 1u);
+		vector <mt19937> engines;
+		for (size_t i = 0; i < threads; i++) {
+			seed_seq sequence {seed, i};
+			engines.push_back (mt19937 (sequence));
+		}
+
+		// Replicates done and replicates which exceed the original statistic
+		size_t total = 0;
+		size_t exceed = 0;
+		size_t count = 0;
+		while (count < replicates) {
+
+			// Split the replicates of this round between the threads
+			const size_t round = min (replicates - count, threads * BOOTSTRAP_BLOCK);
+			vector <size_t> done (threads, 0);
+			vector <size_t> hits (threads, 0);
+			vector <thread> pool;
+			for (size_t i = 0; i < threads; i++) {
+				const size_t chunk = round / threads + (i < round % threads);
+				pool.push_back (thread ([&, i, chunk] {
+
+					// Every thread owns a copy of the fitted model
+					T local (model);
+					for (size_t j = 0; j < chunk; j++)
+					try {
+						const double value = BootstrapCriteria (local, size, engines[i](), estimator);
+						hits[i] += value >= criteria;
+						done[i]++;
+					}
+					// Skip the replicate if the model can not be refitted
+					catch (const exception &exception) {}
+				}));
+			}
+
+			// Wait for all the threads and collect their results
+			for (auto &worker : pool)
+				worker.join();
+			for (size_t i = 0; i < threads; i++) {
+				total += done[i];
+				exceed += hits[i];
+			}
+			count += round;
+
+			// Stop if the confidence level is certainly far from alpha
+			if (alpha > 0.0 && total >= BOOTSTRAP_MIN) {
+				const double level = (exceed + 1.0) / (total + 1.0);
+				const double error = sqrt (level * (1.0 - level) / total);
+				if (abs (level - alpha) > BOOTSTRAP_Z * error)
+					break;
+			}
+		}
+
+		// No replicate is available if the model can not be refitted
+		if (total == 0) return NAN;
+
+		// Return the confidence level
+		return (exceed + 1.0) / (total + 1.0);
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Perform the one-sample or two-sample Kolmogorov-Smirnov test          //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -432,8 +676,17 @@ public:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Score table (confidence level) for different distribution models      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	Mixture models are tested on request only. They are fitted by the
+//			EM algorithm, which is much slower than other estimators, and the
+//			score does not penalize their extra parameters, so they outrank
+//			the single models for unimodal data. The likelihood estimator
+//			skips the models which have no such estimator (Binomial, Negative
+//			Binomial and Asymmetric Laplace), instead of fitting them by the
+//			method of moments under its name
 	static const KolmogorovScoreTable ScoreTable (
-		const Observations &data			// Observations of a random value
+		const Observations &data,			// Observations of a random value
+		Model::Likelihood::EstimatorType estimator,	// Estimator of the model parameters
+		bool mixtures						// Test the mixture models too
 	){
 		// Use shortenings
 		using namespace Model;
@@ -445,26 +698,97 @@ public:
 		KolmogorovScoreTable table;
 
 		// Test available discrete distribution models
-		temp.TestModel <DiscreteUniform> (table, data, "Discrete Uniform");
-		temp.TestModelWithRange <Bernoulli> (table, data, "Bernoulli");
-		temp.TestModelWithRange <Geometric> (table, data, "Geometric");
-		temp.TestModelWithRange <Poisson> (table, data, "Poisson");
-		temp.TestModel <Binomial> (table, data, "Binomial");
-		temp.TestModel <NegativeBinomial> (table, data, "NegativeBinomial");
+		temp.TestModel <DiscreteUniform> (table, data, "Discrete Uniform", estimator);
+		temp.TestModelWithRange <Bernoulli> (table, data, "Bernoulli", estimator);
+		temp.TestModelWithRange <Geometric> (table, data, "Geometric", estimator);
+		temp.TestModelWithRange <Poisson> (table, data, "Poisson", estimator);
+		temp.TestModel <Binomial> (table, data, "Binomial", estimator);
+		temp.TestModel <NegativeBinomial> (table, data, "NegativeBinomial", estimator);
+
+		// Test available continuous distribution models
+		temp.TestModel <ContinuousUniform> (table, data, "Continuous Uniform", estimator);
+		temp.TestModel <Pareto> (table, data, "Pareto", estimator);
+		temp.TestModelWithRange <Rayleigh> (table, data, "Rayleigh", estimator);
+		temp.TestModelWithRange <Exponential> (table, data, "Exponential", estimator);
+		temp.TestModelWithRange <Erlang> (table, data, "Erlang", estimator);
+		temp.TestModelWithRange <ChiSquared> (table, data, "Chi-squared", estimator);
+		temp.TestModelWithRange <Gamma> (table, data, "Gamma", estimator);
+		temp.TestModelWithRange <Beta> (table, data, "Beta", estimator);
+		temp.TestModelWithRange <Logistic> (table, data, "Logistic", estimator);
+		temp.TestModelWithRange <Normal> (table, data, "Normal", estimator);
+		temp.TestModelWithRange <Laplace> (table, data, "Laplace", estimator);
+		temp.TestModelWithRange <AsymmetricLaplace> (table, data, "Asymmetric Laplace", estimator);
+
+		// Test mixture models for multimodal data
+		if (mixtures) {
+			temp.TestModelWithRange <NormalMixture> (table, data, "Normal Mixture", estimator);
+			temp.TestModelWithRange <GammaMixture> (table, data, "Gamma Mixture", estimator);
+			temp.TestModelWithRange <LaplaceMixture> (table, data, "Laplace Mixture", estimator);
+			temp.TestModelWithRange <LogisticMixture> (table, data, "Logistic Mixture", estimator);
+		}
+
+		// Compare function to sort the scores in descending order
+		auto comp = [] (KolmogorovScore a, KolmogorovScore b) {
+			return a.score > b.score;
+		};
+
+		// Rank the scores
+		sort (table.begin(), table.end(), comp);
+		return table;
+	}
+
+	static const KolmogorovScoreTable ScoreTable (
+		const Observations &data,			// Observations of a random value
+		Model::Likelihood::EstimatorType estimator	// Estimator of the model parameters
+	){
+		return ScoreTable (data, estimator, false);
+	}
+
+	static const KolmogorovScoreTable ScoreTable (
+		const Observations &data			// Observations of a random value
+	){
+		return ScoreTable (data, Model::Likelihood::MOMENTS, false);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Bootstrap score table for different distribution models               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The likelihood estimator skips the models which have no such
+//			estimator, the same way as the plain score table does
+	static const KolmogorovScoreTable BootstrapScoreTable (
+		const Observations &data,			// Observations of a random value
+		size_t replicates,					// Count of bootstrap replicates
+		double alpha,						// Rejection level for the early stop
+		size_t seed,						// The seed value
+		Model::Likelihood::EstimatorType estimator	// Estimator of the model parameters
+	){
+		// Use shortenings
+		using namespace Model;
+
+		// Score table
+		KolmogorovScoreTable table;
+
+		// Test available discrete distribution models
+		BootstrapTestModel <DiscreteUniform> (table, data, "Discrete Uniform", replicates, alpha, seed, estimator);
+		BootstrapTestModelWithRange <Bernoulli> (table, data, "Bernoulli", replicates, alpha, seed, estimator);
+		BootstrapTestModelWithRange <Geometric> (table, data, "Geometric", replicates, alpha, seed, estimator);
+		BootstrapTestModelWithRange <Poisson> (table, data, "Poisson", replicates, alpha, seed, estimator);
+		BootstrapTestModel <Binomial> (table, data, "Binomial", replicates, alpha, seed, estimator);
+		BootstrapTestModel <NegativeBinomial> (table, data, "NegativeBinomial", replicates, alpha, seed, estimator);
 
 		// Test available continuous distribution models
-		temp.TestModel <ContinuousUniform> (table, data, "Continuous Uniform");
-		temp.TestModel <Pareto> (table, data, "Pareto");
-		temp.TestModelWithRange <Rayleigh> (table, data, "Rayleigh");
-		temp.TestModelWithRange <Exponential> (table, data, "Exponential");
-		temp.TestModelWithRange <Erlang> (table, data, "Erlang");
-		temp.TestModelWithRange <ChiSquared> (table, data, "Chi-squared");
-		temp.TestModelWithRange <Gamma> (table, data, "Gamma");
-		temp.TestModelWithRange <Beta> (table, data, "Beta");
-		temp.TestModelWithRange <Logistic> (table, data, "Logistic");
-		temp.TestModelWithRange <Normal> (table, data, "Normal");
-		temp.TestModelWithRange <Laplace> (table, data, "Laplace");
-		temp.TestModelWithRange <AsymmetricLaplace> (table, data, "Asymmetric Laplace");
+		BootstrapTestModel <ContinuousUniform> (table, data, "Continuous Uniform", replicates, alpha, seed, estimator);
+		BootstrapTestModel <Pareto> (table, data, "Pareto", replicates, alpha, seed, estimator);
+		BootstrapTestModelWithRange <Rayleigh> (table, data, "Rayleigh", replicates, alpha, seed, estimator);
+		BootstrapTestModelWithRange <Exponential> (table, data, "Exponential", replicates, alpha, seed, estimator);
+		BootstrapTestModelWithRange <Erlang> (table, data, "Erlang", replicates, alpha, seed, estimator);
+		BootstrapTestModelWithRange <ChiSquared> (table, data, "Chi-squared", replicates, alpha, seed, estimator);
+		BootstrapTestModelWithRange <Gamma> (table, data, "Gamma", replicates, alpha, seed, estimator);
+		BootstrapTestModelWithRange <Beta> (table, data, "Beta", replicates, alpha, seed, estimator);
+		BootstrapTestModelWithRange <Logistic> (table, data, "Logistic", replicates, alpha, seed, estimator);
+		BootstrapTestModelWithRange <Normal> (table, data, "Normal", replicates, alpha, seed, estimator);
+		BootstrapTestModelWithRange <Laplace> (table, data, "Laplace", replicates, alpha, seed, estimator);
+		BootstrapTestModelWithRange <AsymmetricLaplace> (table, data, "Asymmetric Laplace", replicates, alpha, seed, estimator);
 
 		// Compare function to sort the scores in descending order
 		auto comp = [] (KolmogorovScore a, KolmogorovScore b) {
@@ -476,6 +800,18 @@ public:
 		return table;
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Bootstrap score table by the method of moments estimator              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static const KolmogorovScoreTable BootstrapScoreTable (
+		const Observations &data,			// Observations of a random value
+		size_t replicates,					// Count of bootstrap replicates
+		double alpha,						// Rejection level for the early stop
+		size_t seed							// The seed value
+	){
+		return BootstrapScoreTable (data, replicates, alpha, seed, Model::Likelihood::MOMENTS);
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Summary of the object                                                 //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
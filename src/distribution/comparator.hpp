@@ -9,14 +9,31 @@
 */
 # pragma	once
 # include	<cmath>
+# include	<algorithm>
+# include	<memory>
 # include	"distribution.hpp"
+# include	"../observations/sample.hpp"
 # include	"../models/discrete/uniform.hpp"
 # include	"../models/discrete/bernoulli.hpp"
 # include	"../models/discrete/geometric.hpp"
 # include	"../models/discrete/binomial.hpp"
 # include	"../models/discrete/negative_binomial.hpp"
 # include	"../models/discrete/poisson.hpp"
+# include	"../models/continuous/uniform.hpp"
+# include	"../models/continuous/rayleigh.hpp"
+# include	"../models/continuous/exponential.hpp"
+# include	"../models/continuous/erlang.hpp"
 # include	"../models/continuous/chi_squared.hpp"
+# include	"../models/continuous/gamma.hpp"
+# include	"../models/continuous/pareto.hpp"
+# include	"../models/continuous/beta.hpp"
+# include	"../models/continuous/logistic.hpp"
+# include	"../models/continuous/normal.hpp"
+# include	"../models/continuous/laplace.hpp"
+# include	"../models/continuous/asymmetric_laplace.hpp"
+
+// Minimal expected count of observations in an equiprobable bin
+# define	PEARSON_MIN_COUNT	5
 
 //****************************************************************************//
 //      Class "PearsonScore"                                                  //
@@ -70,6 +87,10 @@ private:
 	Distribution reference;					// Reference distribution
 	size_t observations;					// Number of collected observations
 	size_t params;							// Number of model parameters
+	size_t intervals;						// Equiprobable bins count (0 - adaptive)
+	shared_ptr <const Observations> data;	// Sorted empirical data (owned copy)
+	vector <double> edges;					// Edges of equiprobable bins
+	vector <double> probs;					// Expected probabilities of the bins
 
 //============================================================================//
 //      Private methods                                                       //
@@ -131,19 +152,107 @@ private:
 		return sum * observations;
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Compute the value of the Pearson's chi-squared test for sorted data   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The data is split into equiprobable bins of a continuous model
+	double PearsonCriteria (
+		const double data[],				// Sorted empirical data
+		size_t size							// Data size
+	) const {
+
+		// Count observations in every bin by one pass over the sorted data
+		const size_t bins = probs.size();
+		vector <size_t> counts (bins, 0);
+		size_t j = 0;
+		for (size_t i = 0; i < size; i++) {
+			while (j < bins - 1 && data [i] > edges [j]) ++j;
+			counts [j]++;
+		}
+
+		// Find the relative error between the observed and expected counts
+		double sum = 0.0;
+		for (size_t i = 0; i < bins; i++) {
+			const double expected = size * probs [i];
+			const double diff = counts [i] - expected;
+			sum += diff * diff / expected;
+		}
+
+		// Return the difference between the empirical dataset and the model
+		return sum;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Split a continuous model into equiprobable bins                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	If the bins count is not set, then it is chosen by the Mann-Wald
+//			rule limited by the minimal expected count in a bin. The edges
+//			and the expected probabilities are computed once for the model
+//			and are reused for every next batch tested against it
+	void EquiprobableBins (
+		const Model::BaseModel &model		// Theoretical model
+	){
+		// Choose the bins count
+		size_t bins = intervals;
+		if (!bins) {
+			bins = size_t (round (2.0 * pow (observations, 0.4)));
+			bins = min (bins, observations / PEARSON_MIN_COUNT);
+			bins = max (bins, size_t (1));
+		}
+
+		// Find the bin edges using the model quantiles
+		vector <double> levels;
+		for (size_t i = 1; i < bins; i++)
+			levels.push_back (double (i) / bins);
+		edges = model.Quantiles (levels);
+
+		// Compute the expected probabilities of the bins
+		probs.clear();
+		double last_cdf = 0.0;
+		for (const auto x : edges) {
+			const double cur_cdf = model.CDF (x);
+			probs.push_back (cur_cdf - last_cdf);
+			last_cdf = cur_cdf;
+		}
+		probs.push_back (1.0 - last_cdf);
+
+		// Check if all the bins are not empty
+		for (const auto p : probs) {
+			if (p <= 0.0)
+				throw invalid_argument ("EquiprobableBins: Can not split the distribution model into equiprobable bins");
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Compute the value of the Pearson's chi-squared test                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double PearsonCriteria (
+		size_t &bins						// Bins count of the test
+	) const {
+
+		// Check type of the reference distribution
+		if (reference.Type() == Distribution::THEORETICAL_CONTINUOUS) {
+			bins = probs.size();
+			return PearsonCriteria (data -> RankedData(), data -> Size());
+		}
+		else {
+			bins = sample.Bins();
+			return PearsonCriteria();
+		}
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Compute the confidence level of Pearson's chi-squared test            //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	double PearsonLevel (void) const {
+	double PearsonLevel (
+		double criteria,					// Value of the Pearson's chi-squared test
+		size_t bins							// Bins count of the test
+	) const {
 
 		// Use shortenings
 		using namespace Model;
 
-		// Compute the value of the Pearson's chi-squared test
-		const double criteria = PearsonCriteria();
-
 		// Calculate the degrees of freedom of the Chi-squared distribution
-		size_t bins = sample.Bins();
 		size_t correction = params + 1;
 		if (bins > correction) {
 
@@ -167,10 +276,10 @@ private:
 		using namespace Model;
 
 		// Compute the value of the Pearson's chi-squared test
-		const double criteria = PearsonCriteria();
+		size_t bins;
+		const double criteria = PearsonCriteria (bins);
 
 		// Calculate the degrees of freedom of the Chi-squared distribution
-		size_t bins = sample.Bins();
 		size_t correction = params + 1;
 		if (bins > correction) {
 
@@ -194,21 +303,33 @@ public:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Constructors from empirical data                                      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The comparator keeps its own ranked copy of the data, so it does
+//			not depend on the lifetime of the source observations. The
+//			chi-squared test counts the observations in the bins, so the
+//			weighted observations are rejected
 
 	// Discrete distribution
 	DistComparator (
 		const Observations &data			// Observations of a random value
 	) : sample (data),
 		observations (data.Size()),
-		params (0)
-	{}
+		params (0),
+		intervals (0),
+		data (make_shared <const ::Sample> (data.Data()))
+	{
+		// Check if the observations are not weighted
+		if (data.Weighted())
+			throw invalid_argument ("DistComparator: Pearson's chi-squared test does not support weighted observations");
+	}
 
 	// Discrete distribution
 	DistComparator (
 		const vector <double> &data			// Empirical data
 	) : sample (data),
 		observations (data.size()),
-		params (0)
+		params (0),
+		intervals (0),
+		data (make_shared <const ::Sample> (data))
 	{}
 
 	// Discrete distribution
@@ -223,8 +344,14 @@ public:
 		size_t bins							// Bins count for a histogram
 	) : sample (data, bins),
 		observations (data.Size()),
-		params (0)
-	{}
+		params (0),
+		intervals (bins),
+		data (make_shared <const ::Sample> (data.Data()))
+	{
+		// Check if the observations are not weighted
+		if (data.Weighted())
+			throw invalid_argument ("DistComparator: Pearson's chi-squared test does not support weighted observations");
+	}
 
 	// Continuous distribution
 	DistComparator (
@@ -232,7 +359,9 @@ public:
 		size_t bins							// Bins count for a histogram
 	) : sample (data, bins),
 		observations (data.size()),
-		params (0)
+		params (0),
+		intervals (bins),
+		data (make_shared <const ::Sample> (data))
 	{}
 
 	// Continuous distribution
@@ -312,6 +441,10 @@ public:
 			// Set the distribution model
 			reference = Distribution (model, sample.Values());
 			params = model.Parameters();
+
+			// Continuous models are tested using equiprobable bins
+			if (reference.Type() == Distribution::THEORETICAL_CONTINUOUS)
+				EquiprobableBins (model);
 		}
 		else
 			throw invalid_argument ("ReferenceModel: The sample data range is outside the distribution model domain");
@@ -357,10 +490,12 @@ public:
 
 			// Check type of the reference distribution
 			Distribution::DistType type = reference.Type();
-			if (type == Distribution::THEORETICAL_DISCRETE)
-				return PearsonLevel();
-			else if (type == Distribution::THEORETICAL_CONTINUOUS)
-				throw invalid_argument ("PearsonConfidenceLevel: Only discrete distribution models can be tested");
+			if (type == Distribution::THEORETICAL_DISCRETE ||
+				type == Distribution::THEORETICAL_CONTINUOUS) {
+				size_t bins;
+				const double criteria = PearsonCriteria (bins);
+				return PearsonLevel (criteria, bins);
+			}
 			else
 				throw invalid_argument ("PearsonConfidenceLevel: Can calculate the critical confidence level for a theoretical model only");
 		}
@@ -368,6 +503,34 @@ public:
 			throw invalid_argument ("PearsonConfidenceLevel: Set a sample and a reference for the confidence level");
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Confidence level of Pearson's chi-squared test for a new batch        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The batch is tested against the continuous model already loaded,
+//			so the equiprobable bins of the model are not computed again
+	double PearsonConfidenceLevel (
+		const Observations &batch			// Observations of a random value
+	) const {
+
+		// Check if the observations are not weighted
+		if (batch.Weighted())
+			throw invalid_argument ("PearsonConfidenceLevel: Pearson's chi-squared test does not support weighted observations");
+
+		// Check type of the reference distribution
+		if (reference.Type() == Distribution::THEORETICAL_CONTINUOUS) {
+			const double criteria = PearsonCriteria (batch.RankedData(), batch.Size());
+			return PearsonLevel (criteria, probs.size());
+		}
+		else
+			throw invalid_argument ("PearsonConfidenceLevel: Batches can be tested against a continuous model only");
+	}
+
+	double PearsonConfidenceLevel (
+		const pylist &py_list				// Empirical data
+	) const {
+		return PearsonConfidenceLevel (::Sample (py_list));
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Perform the Pearson's chi-squared test                                //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -383,10 +546,9 @@ public:
 
 				// Check type of the reference distribution
 				Distribution::DistType type = reference.Type();
-				if (type == Distribution::THEORETICAL_DISCRETE)
+				if (type == Distribution::THEORETICAL_DISCRETE ||
+					type == Distribution::THEORETICAL_CONTINUOUS)
 					return PearsonTest (1.0 - level);
-				else if (type == Distribution::THEORETICAL_CONTINUOUS)
-					throw invalid_argument ("PearsonTest: Only discrete distribution models can be tested");
 				else
 					throw invalid_argument ("PearsonTest: Pearson's chi-squared test is available for a theoretical model only");
 			}
@@ -420,6 +582,20 @@ public:
 		temp.TestModelWithRange <Geometric> (table, data, "Geometric");
 		temp.TestModelWithRange <Poisson> (table, data, "Poisson");
 
+		// Test available continuous distribution models
+		temp.TestModel <ContinuousUniform> (table, data, "Continuous Uniform");
+		temp.TestModel <Pareto> (table, data, "Pareto");
+		temp.TestModelWithRange <Rayleigh> (table, data, "Rayleigh");
+		temp.TestModelWithRange <Exponential> (table, data, "Exponential");
+		temp.TestModelWithRange <Erlang> (table, data, "Erlang");
+		temp.TestModelWithRange <ChiSquared> (table, data, "Chi-squared");
+		temp.TestModelWithRange <Gamma> (table, data, "Gamma");
+		temp.TestModelWithRange <Beta> (table, data, "Beta");
+		temp.TestModelWithRange <Logistic> (table, data, "Logistic");
+		temp.TestModelWithRange <Normal> (table, data, "Normal");
+		temp.TestModelWithRange <Laplace> (table, data, "Laplace");
+		temp.TestModelWithRange <AsymmetricLaplace> (table, data, "Asymmetric Laplace");
+
 		// Compare function to sort the scores in descending order
 		auto comp = [] (PearsonScore a, PearsonScore b) {
 			return a.score > b.score;
@@ -0,0 +1,120 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#              BENCHMARK OF THE MODEL EVALUATION IN THE HOT LOOPS              #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+// INFO:	The program times the theoretical RawCDF tables and the quantile
+//			solver for the concrete model types, which are the hot loops of
+//			the score tables. It uses the public interface only, so the same
+//			program builds against any revision of the tree. Build it against
+//			the revisions to compare and run them on an idle machine. Every
+//			line reports the best time of the runs and a checksum, so equal
+//			checksums confirm the revisions compute the same values. Build it
+//			as any wrapper of the module, for example:
+//
+//			g++ -std=c++17 -O2 -mavx2 -pthread dispatch_benchmark.cpp
+//				$(python3-config --includes --ldflags --embed) -lboost_python3
+# include	<boost/python.hpp>
+# include	<chrono>
+# include	<cstdio>
+# include	"raw.hpp"
+# include	"../models/discrete/poisson.hpp"
+# include	"../models/continuous/uniform.hpp"
+# include	"../models/continuous/normal.hpp"
+# include	"../models/continuous/logistic.hpp"
+# include	"../models/continuous/gamma.hpp"
+# include	"../models/continuous/beta.hpp"
+# include	"../models/continuous/standard_t.hpp"
+
+// Count of points in every RawCDF table
+# define	BENCH_POINTS		4000000
+
+// Count of quantile levels to solve
+# define	BENCH_LEVELS		200000
+
+// Count of runs to take the best time of
+# define	BENCH_RUNS			5
+
+//****************************************************************************//
+//      Best time of the runs of a function in milliseconds                   //
+//****************************************************************************//
+template <typename F>
+static double Measure (
+	F function,						// Function to time
+	double &checksum				// Checksum of the function results
+){
+	double best = INFINITY;
+	for (size_t i = 0; i < BENCH_RUNS; i++) {
+		const auto start = chrono::steady_clock::now();
+		checksum = function();
+		const auto stop = chrono::steady_clock::now();
+		best = min (best, chrono::duration <double, milli> (stop - start).count());
+	}
+	return best;
+}
+
+//****************************************************************************//
+//      Time the RawCDF table and the quantiles of a model                    //
+//****************************************************************************//
+template <typename T>
+static void Bench (
+	const char *name,				// Model name
+	const T &model,					// Distribution model
+	double min,						// The first point of the table
+	double max						// The last point of the table
+){
+	// Points of the table and the levels of the quantiles
+	vector <double> points (BENCH_POINTS);
+	for (size_t i = 0; i < BENCH_POINTS; i++)
+		points [i] = min + (max - min) * i / (BENCH_POINTS - 1);
+	vector <double> levels (BENCH_LEVELS);
+	for (size_t i = 0; i < BENCH_LEVELS; i++)
+		levels [i] = (i + 0.5) / BENCH_LEVELS;
+
+	// Build the RawCDF table through the concrete model type
+	double sum1;
+	const double time1 = Measure ([&] {
+		const RawCDF table (model, points);
+		double sum = 0.0;
+		for (const auto value : table.CDF())
+			sum += value;
+		return sum;
+	}, sum1);
+
+	// Solve the quantiles through the concrete model type
+	double sum2;
+	const double time2 = Measure ([&] {
+		double sum = 0.0;
+		for (const auto level : levels)
+			sum += model.Quantile (level);
+		return sum;
+	}, sum2);
+
+	// Report the results
+	printf ("%-10s %10.1f ms %10.1f ms   %.17g %.17g\n", name, time1, time2, sum1, sum2);
+}
+
+//****************************************************************************//
+//      Time all the models                                                   //
+//****************************************************************************//
+int main (void) {
+	using namespace Model;
+	printf ("%-10s %13s %13s   %s\n", "model", "RawCDF", "Quantile", "checksums");
+	Bench ("Uniform", ContinuousUniform (0.0, 1.0), 0.0, 1.0);
+	Bench ("Normal", Normal (0.0, 1.0), -8.0, 8.0);
+	Bench ("Logistic", Logistic (0.0, 1.0), -30.0, 30.0);
+	Bench ("Gamma", Gamma (2.5, 1.0), 0.0, 40.0);
+	Bench ("Beta", Beta (2.0, 5.0), 0.0, 1.0);
+	Bench ("StudentT", StandardT (5), -50.0, 50.0);
+	Bench ("Poisson", Poisson (1000.0), 0.0, 2000.0);
+	return EXIT_SUCCESS;
+}
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -37,6 +37,7 @@ private:
 	vector <double> values;				// Unique values
 	vector <double> pdf;				// Computed values of a PDF function
 	vector <double> cdf;				// Computed values of a CDF function
+	LookupIndex lookup;					// Fast lookup index for the values
 
 //============================================================================//
 //      Private methods                                                       //
@@ -57,6 +58,30 @@ private:
 			cdf.push_back (cur_cdf);
 			last_cdf = cur_cdf;
 		}
+
+		// Build the fast lookup index for the values
+		lookup = LookupIndex (values);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Calculate theoretical PDF and CDF values for a discrete distribution  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The values are read from the cached CMF table of the model, so
+//			the model CDF function is called only outside its location
+	void InitModel (
+		const Model::BaseDiscrete &model	// Theoretical model
+	){
+		// Fill the theoretical CDF table
+		double last_cdf = model.CachedCDF (range.Min() - 1.0);
+		for (const auto x : values) {
+			const double cur_cdf = model.CachedCDF (x);
+			pdf.push_back (cur_cdf - last_cdf);
+			cdf.push_back (cur_cdf);
+			last_cdf = cur_cdf;
+		}
+
+		// Build the fast lookup index for the values
+		lookup = LookupIndex (values);
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -97,6 +122,9 @@ private:
 		const double cur_cdf = func [func.size() - 1];
 		pdf.push_back (cur_cdf - last_cdf);
 		cdf.push_back (cur_cdf);
+
+		// Build the fast lookup index for the values
+		lookup = LookupIndex (values);
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -146,6 +174,9 @@ private:
 		const double cur_cdf = func [func.size() - 1];
 		pdf.push_back (cur_cdf - last_cdf);
 		cdf.push_back (cur_cdf);
+
+		// Build the fast lookup index for the values
+		lookup = LookupIndex (values);
 	}
 
 //============================================================================//
@@ -171,7 +202,7 @@ public:
 		values (values)
 	{
 		// Calculate theoretical PDF and CDF values for a discrete model
-		InitModel (model, model.CDF (range.Min() - 1.0));
+		InitModel (model);
 	}
 
 	// Discrete distribution
@@ -179,10 +210,12 @@ public:
 		const Model::BaseDiscrete &model	// Theoretical model
 	) :	type (THEORETICAL_DISCRETE),
 		range (model.DistLocation()),
-		values (range.Linear())
+		values (range.Linear()),
+		pdf (model.PMF()),
+		cdf (model.CMF())
 	{
-		// Calculate theoretical PDF and CDF values for a discrete model
-		InitModel (model, model.CDF (range.Min() - 1.0));
+		// The model location matches its cached tables, so copy them as is
+		lookup = LookupIndex (values);
 	}
 
 	// Continuous distribution
@@ -343,10 +376,34 @@ public:
 	) const {
 
 		// Find the greatest element that is still less than or equal to the target value
-		const size_t index = Array::BinSearchLessOrEqual (values.data(), values.size(), x);
+		const size_t index = lookup.Find (values, x);
 		return index != static_cast <size_t> (-1) ? cdf [index] : 0.0;
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Find values of the CDF function for a batch of Х                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> GetCDF (
+		const vector <double> &x		// Argument values
+	) const {
+
+		// Find the greatest elements that are still less than or equal to the target values
+		const vector <size_t> &indices = lookup.Find (values, x);
+
+		// Collect the CDF values
+		vector <double> result;
+		result.reserve (indices.size());
+		for (const auto index : indices)
+			result.push_back (index != static_cast <size_t> (-1) ? cdf [index] : 0.0);
+		return result;
+	}
+
+	vector <double> GetCDF (
+		const pylist &py_list			// Argument values
+	) const {
+		return GetCDF (to_vector (py_list));
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Find a value of the PDF function for an arbitrary Х                   //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -355,10 +412,34 @@ public:
 	) const {
 
 		// Find the greatest element that is still less than or equal to the target value
-		const size_t index = Array::BinSearchLessOrEqual (values.data(), values.size(), x);
+		const size_t index = lookup.Find (values, x);
 		return index != static_cast <size_t> (-1) ? pdf [index] : 0.0;
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Find values of the PDF function for a batch of Х                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> GetPDF (
+		const vector <double> &x		// Argument values
+	) const {
+
+		// Find the greatest elements that are still less than or equal to the target values
+		const vector <size_t> &indices = lookup.Find (values, x);
+
+		// Collect the PDF values
+		vector <double> result;
+		result.reserve (indices.size());
+		for (const auto index : indices)
+			result.push_back (index != static_cast <size_t> (-1) ? pdf [index] : 0.0);
+		return result;
+	}
+
+	vector <double> GetPDF (
+		const pylist &py_list			// Argument values
+	) const {
+		return GetPDF (to_vector (py_list));
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Summary of the object                                                 //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -0,0 +1,503 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                          KERNEL DENSITY ESTIMATION                           #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<cmath>
+# include	"../python_helpers.hpp"
+# include	"../models/range.hpp"
+# include	"../observations/sample.hpp"
+# include	"../templates/fft.hpp"
+# include	"../object_summary.hpp"
+
+// Support of the Gaussian kernel in bandwidths
+# define	KDE_GAUSSIAN_TAIL	4.0
+
+// Scale of the inter-quartile range to match the standard deviation
+# define	KDE_IQR_SCALE		1.349
+
+//****************************************************************************//
+//      Class "KernelDensity"                                                 //
+//****************************************************************************//
+// INFO:	Observations are linearly binned onto a uniform grid and then the
+//			bin counts are convolved with the kernel using FFT, so the whole
+//			estimation costs O(N + G log G). If the grid reaches a finite
+//			bound of the domain, then the counts are reflected about the
+//			bound to remove the boundary bias. The weights of the observations
+//			are counts of the values, so every observation is binned by its
+//			weight, and the sum of the weights replaces the count of them
+class KernelDensity
+{
+//============================================================================//
+//      Kernel and bandwidth types                                            //
+//============================================================================//
+public:
+	enum KernelType {
+		GAUSSIAN,						// Gaussian kernel
+		EPANECHNIKOV					// Epanechnikov kernel
+	};
+
+	enum BandwidthType {
+		SILVERMAN,						// Silverman's rule of thumb
+		SCOTT,							// Scott's rule of thumb
+		PLUGIN							// Sheather-Jones direct plug-in
+	};
+
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	KernelType kernel;					// Kernel type
+	Model::Range domain;				// Domain of the random value
+	double bandwidth;					// Kernel bandwidth
+	vector <double> values;				// Grid points
+	vector <double> pdf;				// Estimated density at the grid points
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Kernel function                                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double Kernel (
+		KernelType kernel,				// Kernel type
+		double u						// Argument value
+	){
+		if (kernel == EPANECHNIKOV)
+			return abs (u) < 1.0 ? 0.75 * (1.0 - u * u) : 0.0;
+		else
+			return exp (-0.5 * u * u) / sqrt (2.0 * M_PI);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Kernel support in bandwidths                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double Tail (
+		KernelType kernel				// Kernel type
+	){
+		return kernel == EPANECHNIKOV ? 1.0 : KDE_GAUSSIAN_TAIL;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ratio of the kernel bandwidth to the equivalent Gaussian bandwidth    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	Canonical bandwidths of the kernels are (R(K) / mu2(K)^2)^(1/5)
+	static double Canonical (
+		KernelType kernel				// Kernel type
+	){
+		return kernel == EPANECHNIKOV ? pow (30.0 * sqrt (M_PI), 0.2) : 1.0;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Robust scale of the observations                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double Scale (
+		const Observations &data		// Observations of a random value
+	){
+		const double stddev = data.StdDev();
+		const double iqr = data.InterQuartileRange() / KDE_IQR_SCALE;
+		if (stddev > 0.0 && iqr > 0.0)
+			return min (stddev, iqr);
+		else
+			return max (stddev, iqr);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Linear binning of the observations onto a uniform grid                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static vector <double> Binning (
+		const Observations &data,		// Observations of a random value
+		double start,					// The first grid point
+		double step,					// Grid step
+		size_t points					// Count of grid points
+	){
+		// Split every observation between two nearest grid points
+		const double *values = data.RankedData();
+		const double *weights = data.RankedWeights();
+		vector <double> counts (points, 0.0);
+		for (size_t i = 0; i < data.Size(); i++) {
+			const double position = (values [i] - start) / step;
+			if (position < 0.0 || position > points - 1) continue;
+			const size_t index = min (size_t (position), points - 2);
+			const double count = weights ? weights [i] : 1.0;
+			const double weight = position - index;
+			counts [index] += count * (1.0 - weight);
+			counts [index + 1] += count * weight;
+		}
+		return counts;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Binned estimation of the density derivative functional                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	Estimation of the integral of f(x) * f^(r)(x) for r = 4 or 6,
+//			using the Gaussian kernel with the pilot bandwidth. The sum over
+//			all the pairs of grid points is the convolution of the bin counts
+//			with the kernel derivative, which FFT finds in O(G log G)
+	static double Functional (
+		const vector <double> &counts,	// Binned observations
+		double step,					// Grid step
+		double size,					// Count of observations (sum of the weights)
+		double pilot,					// Pilot bandwidth
+		size_t order					// Derivative order
+	){
+		// Derivatives of the Gaussian kernel for all the grid lags
+		// The kernel is not truncated, since the derivatives have heavy
+		// tails, which cancel the central part
+		const size_t points = counts.size();
+		vector <double> derivs (2 * points - 1);
+		for (size_t m = 0; m < points; m++) {
+			const double z = m * step / pilot;
+			const double z2 = z * z;
+			const double phi = exp (-0.5 * z2) / sqrt (2.0 * M_PI);
+			const double deriv = order == 4 ?
+				((z2 - 6.0) * z2 + 3.0) * phi :
+				(((z2 - 15.0) * z2 + 45.0) * z2 - 15.0) * phi;
+			derivs [points - 1 + m] = derivs [points - 1 - m] = deriv;
+		}
+
+		// Convolve the counts with the derivatives and weight the result
+		// by the counts again
+		const vector <double> &conv = FFT::Convolve (counts, derivs);
+		double sum = 0.0;
+		for (size_t k = 0; k < points; k++)
+			sum += counts [k] * conv [points - 1 + k];
+		return sum / (size * size * pow (pilot, order + 1));
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Silverman's rule of thumb for the Gaussian bandwidth                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double Silverman (
+		const Observations &data		// Observations of a random value
+	){
+		return 0.9 * Scale (data) * pow (data.TotalWeight(), -0.2);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Scott's rule of thumb for the Gaussian bandwidth                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double Scott (
+		const Observations &data		// Observations of a random value
+	){
+		return 1.06 * data.StdDev() * pow (data.TotalWeight(), -0.2);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Two-stage direct plug-in Gaussian bandwidth (Sheather-Jones)          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double PlugIn (
+		const Observations &data,		// Observations of a random value
+		size_t points					// Count of grid points
+	){
+		// Bin the observations over their range
+		const double size = data.TotalWeight();
+		const Model::Range &range = data.Domain();
+		const double step = range.Length() / (points - 1);
+		const double scale = Scale (data);
+		if (step <= 0.0 || scale <= 0.0)
+			return Silverman (data);
+		const vector <double> &counts = Binning (data, range.Min(), step, points);
+
+		// The normal scale estimation of the 8th derivative functional
+		const double psi8 = 105.0 / (32.0 * sqrt (M_PI) * pow (scale, 9));
+
+		// The first stage: estimate the 6th derivative functional
+		const double g1 = pow (30.0 / (sqrt (2.0 * M_PI) * psi8 * size), 1.0 / 9.0);
+		const double psi6 = Functional (counts, step, size, g1, 6);
+		if (psi6 >= 0.0)
+			return Silverman (data);
+
+		// The second stage: estimate the 4th derivative functional
+		const double g2 = pow (-6.0 / (sqrt (2.0 * M_PI) * psi6 * size), 1.0 / 7.0);
+		const double psi4 = Functional (counts, step, size, g2, 4);
+		if (psi4 <= 0.0)
+			return Silverman (data);
+
+		// Asymptotically optimal bandwidth for the estimated functional
+		return pow (1.0 / (2.0 * sqrt (M_PI) * psi4 * size), 0.2);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Select the kernel bandwidth                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double Bandwidth (
+		const Observations &data,		// Observations of a random value
+		KernelType kernel,				// Kernel type
+		BandwidthType selector,			// Bandwidth selector
+		size_t points					// Count of grid points
+	){
+		// Check if the dataset is big enough
+		if (data.Size() < 2)
+			throw invalid_argument ("KernelDensity: Can not select the bandwidth for less than two observations");
+
+		// Select the equivalent Gaussian bandwidth
+		double gaussian;
+		switch (selector)
+		{
+			case SCOTT:
+				gaussian = Scott (data);
+				break;
+
+			case PLUGIN:
+				gaussian = PlugIn (data, points);
+				break;
+
+			default:
+				gaussian = Silverman (data);
+				break;
+		}
+
+		// Translate it to the kernel bandwidth
+		return gaussian * Canonical (kernel);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Estimate the density at the grid points                               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Estimate (
+		const Observations &data,		// Observations of a random value
+		size_t points					// Count of grid points
+	){
+		// Check the arguments
+		if (points < 2)
+			throw invalid_argument ("KernelDensity: The grid must have at least two points");
+		if (!(bandwidth > 0.0))
+			throw invalid_argument ("KernelDensity: The bandwidth must be positive");
+		if (!(domain >= data.Domain()))
+			throw invalid_argument ("KernelDensity: The data range is outside the domain");
+
+		// Extend the data range by the kernel support and clamp it to the domain
+		const double tail = Tail (kernel) * bandwidth;
+		const Model::Range &range = data.Domain();
+		const bool lower = range.Min() - tail < domain.Min();
+		const bool upper = range.Max() + tail > domain.Max();
+		const double start = lower ? domain.Min() : range.Min() - tail;
+		const double stop = upper ? domain.Max() : range.Max() + tail;
+		const double step = (stop - start) / (points - 1);
+
+		// Bin the observations onto the grid
+		const vector <double> &counts = Binning (data, start, step, points);
+
+		// Kernel weights for the grid lags inside the kernel support
+		const size_t lags = min (points - 1, size_t (ceil (tail / step)));
+		vector <double> weights;
+		for (size_t i = 0; i <= 2 * lags; i++) {
+			const double u = (double (i) - double (lags)) * step / bandwidth;
+			weights.push_back (Kernel (kernel, u) / bandwidth);
+		}
+
+		// Pad the counts by the lags and reflect them about the domain bounds
+		vector <double> padded (points + 2 * lags, 0.0);
+		for (size_t i = 0; i < points; i++)
+			padded [lags + i] = counts [i];
+		for (size_t i = 0; i <= lags; i++) {
+			if (lower) padded [lags - i] += counts [i];
+			if (upper) padded [lags + points - 1 + i] += counts [points - 1 - i];
+		}
+
+		// Convolve the counts with the kernel
+		const vector <double> &conv = FFT::Convolve (padded, weights);
+
+		// Save the grid and the estimated density
+		const double size = data.TotalWeight();
+		values.clear();
+		pdf.clear();
+		for (size_t i = 0; i < points; i++) {
+			values.push_back (start + i * step);
+			pdf.push_back (max (conv [2 * lags + i] / size, 0.0));
+		}
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructors with the bandwidth selection                             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	KernelDensity (
+		const Observations &data,		// Observations of a random value
+		const Model::Range &domain,		// Domain of the random value
+		KernelType kernel,				// Kernel type
+		BandwidthType selector,			// Bandwidth selector
+		size_t points					// Count of grid points
+	) :	kernel (kernel),
+		domain (domain),
+		bandwidth (Bandwidth (data, kernel, selector, points))
+	{
+		// Estimate the density at the grid points
+		Estimate (data, points);
+	}
+
+	KernelDensity (
+		const Observations &data,		// Observations of a random value
+		KernelType kernel,				// Kernel type
+		BandwidthType selector,			// Bandwidth selector
+		size_t points					// Count of grid points
+	) :	KernelDensity (data, Model::Range (-INFINITY, INFINITY), kernel, selector, points)
+	{}
+
+	KernelDensity (
+		const pylist &py_list,			// Empirical data
+		const Model::Range &domain,		// Domain of the random value
+		KernelType kernel,				// Kernel type
+		BandwidthType selector,			// Bandwidth selector
+		size_t points					// Count of grid points
+	) :	KernelDensity (Sample (py_list), domain, kernel, selector, points)
+	{}
+
+	KernelDensity (
+		const pylist &py_list,			// Empirical data
+		KernelType kernel,				// Kernel type
+		BandwidthType selector,			// Bandwidth selector
+		size_t points					// Count of grid points
+	) :	KernelDensity (Sample (py_list), kernel, selector, points)
+	{}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructors with the bandwidth provided                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	KernelDensity (
+		const Observations &data,		// Observations of a random value
+		const Model::Range &domain,		// Domain of the random value
+		KernelType kernel,				// Kernel type
+		double bandwidth,				// Kernel bandwidth
+		size_t points					// Count of grid points
+	) :	kernel (kernel),
+		domain (domain),
+		bandwidth (bandwidth)
+	{
+		// Estimate the density at the grid points
+		Estimate (data, points);
+	}
+
+	KernelDensity (
+		const pylist &py_list,			// Empirical data
+		const Model::Range &domain,		// Domain of the random value
+		KernelType kernel,				// Kernel type
+		double bandwidth,				// Kernel bandwidth
+		size_t points					// Count of grid points
+	) :	KernelDensity (Sample (py_list), domain, kernel, bandwidth, points)
+	{}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Kernel type                                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	KernelType Kernel (void) const {
+		return kernel;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Domain of the random value                                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const Model::Range& Domain (void) const {
+		return domain;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Kernel bandwidth                                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double Bandwidth (void) const {
+		return bandwidth;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Grid points                                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const vector <double>& Values (void) const {
+		return values;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Estimated density at the grid points                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const vector <double>& PDF (void) const {
+		return pdf;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Estimated density for an arbitrary Х                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	We do linear interpolation between two nearest grid points
+	double GetPDF (
+		double x						// Argument value
+	) const {
+
+		// Outside the grid
+		const double start = values.front();
+		const double step = values [1] - start;
+		const double position = (x - start) / step;
+		const size_t points = values.size();
+		if (!(position >= 0.0 && position <= points - 1))
+			return 0.0;
+
+		// Interpolate between two nearest grid points
+		const size_t index = min (size_t (position), points - 2);
+		const double gain = position - index;
+		return (1.0 - gain) * pdf [index] + gain * pdf [index + 1];
+	}
+
+	vector <double> GetPDF (
+		const vector <double> &x		// Argument values
+	) const {
+		vector <double> result;
+		result.reserve (x.size());
+		for (const auto value : x)
+			result.push_back (GetPDF (value));
+		return result;
+	}
+
+	vector <double> GetPDF (
+		const pylist &py_list			// Argument values
+	) const {
+		return GetPDF (to_vector (py_list));
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Summary of the object                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	ObjectSummary Summary (void) const {
+
+		// Create the summary storage
+		ObjectSummary summary = Domain().Summary();
+		if (Kernel() == EPANECHNIKOV)
+			summary.Name ("Epanechnikov kernel density estimation");
+		else
+			summary.Name ("Gaussian kernel density estimation");
+
+		// Domain of the random value
+		summary.Groups()[0].Name ("Domain");
+
+		// Estimation info
+		PropGroup info;
+		info.Append ("Bandwidth", Bandwidth());
+		info.Append ("Grid points", Values().size());
+		summary.Prepend (info);
+
+		// Return the summary
+		return summary;
+	}
+};
+
+//****************************************************************************//
+//      Translate the object to a string                                      //
+//****************************************************************************//
+ostream& operator << (ostream &stream, const KernelDensity &object)
+{
+	stream << object.Summary();
+	return stream;
+}
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -0,0 +1,150 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                   FAST LOOKUP INDEX FOR SORTED UNIQUE VALUES                 #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<cmath>
+# include	<vector>
+# include	<algorithm>
+# include	"../templates/array.hpp"
+
+// Use shortenings
+using namespace std;
+
+//****************************************************************************//
+//      Class "LookupIndex"                                                   //
+//****************************************************************************//
+// INFO:	The index splits the values range into a uniform grid of buckets
+//			and keeps the first value of every bucket. A lookup computes the
+//			bucket of the target value directly and then searches only inside
+//			the bucket, which usually holds one or two values. The index does
+//			not own the values, they must be passed to the lookup functions
+class LookupIndex
+{
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	double min;							// The smallest indexed value
+	double scale;						// Buckets count per unit of the range
+	size_t buckets;						// Count of buckets in the grid
+	vector <size_t> start;				// The first value index of every bucket
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Bucket of the target value                                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The function is monotone, so all values of lower buckets are less
+//			than the target value, and all values of upper buckets are greater
+	size_t Bucket (
+		double x						// Target value
+	) const {
+		const double offset = (x - min) * scale;
+		if (!(offset > 0.0)) return 0;
+		if (offset >= buckets) return buckets - 1;
+		return size_t (offset);
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Default constructor                                                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	LookupIndex (void) : min (0.0), scale (0.0), buckets (0) {}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Build the index for sorted unique values                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	LookupIndex (
+		const vector <double> &values	// Sorted unique values
+	) : min (0.0), scale (0.0), buckets (0)
+	{
+		// Check if the values are not empty
+		const size_t size = values.size();
+		if (size == 0) return;
+
+		// One bucket per value on average
+		buckets = size;
+		min = values.front();
+		const double length = values.back() - min;
+		scale = length > 0.0 ? buckets / length : 0.0;
+
+		// Count the values in every bucket
+		start.assign (buckets + 1, 0);
+		for (const auto x : values)
+			start [Bucket (x) + 1]++;
+
+		// Convert the counts into the first value index of every bucket
+		for (size_t i = 0; i < buckets; i++)
+			start [i + 1] += start [i];
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Find the greatest value that is still less than or equal to X         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Find (
+		const vector <double> &values,	// Sorted unique values of the index
+		double x						// Target value
+	) const {
+
+		// Check if the index is built
+		if (buckets == 0)
+			return Array::BinSearchLessOrEqual (values.data(), values.size(), x);
+
+		// Search inside the bucket of the target value only
+		const size_t bucket = Bucket (x);
+		const size_t first = start [bucket];
+		const size_t last = start [bucket + 1];
+		return first + Array::BinSearchLessOrEqual (values.data() + first, last - first, x);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Find the greatest values that are still less than or equal to X       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	Sorted target values are found by one merge walk over the values
+	vector <size_t> Find (
+		const vector <double> &values,	// Sorted unique values of the index
+		const vector <double> &x		// Target values
+	) const {
+
+		// The accumulator for found indices
+		vector <size_t> result;
+		result.reserve (x.size());
+
+		// Unsorted target values are found one by one
+		if (!is_sorted (x.begin(), x.end())) {
+			for (const auto value : x)
+				result.push_back (Find (values, value));
+		}
+
+		// Sorted target values are found by the merge walk
+		else if (!x.empty()) {
+			size_t j = Find (values, x.front()) + 1;
+			const size_t size = values.size();
+			for (const auto value : x) {
+				while (j < size && values [j] <= value) ++j;
+				result.push_back (j - 1);
+			}
+		}
+
+		// Return all the found indices
+		return result;
+	}
+};
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
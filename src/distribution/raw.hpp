@@ -13,6 +13,7 @@
 # include	"../models/continuous/continuous.hpp"
 # include	"../observations/observations.hpp"
 # include	"../object_summary.hpp"
+# include	"lookup.hpp"
 
 // Bins count to instantiate a continuous theoretical model
 # define	BINS	1000
@@ -40,6 +41,7 @@ private:
 	Model::Range range;					// Values range
 	vector <double> values;				// Unique values
 	vector <double> cdf;				// Computed values of a CDF function
+	LookupIndex lookup;					// Fast lookup index for the values
 
 //============================================================================//
 //      Private methods                                                       //
@@ -53,36 +55,58 @@ private:
 		const Model::BaseModel &model	// Theoretical model
 	){
 		// Fill the theoretical CDF table
+		cdf.reserve (values.size());
 		for (const auto x : values)
 			cdf.push_back (model.CDF (x));
+
+		// Build the fast lookup index for the values
+		lookup = LookupIndex (values);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Calculate theoretical CDF values for a discrete model                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Init (
+		const Model::BaseDiscrete &model	// Theoretical model
+	){
+		// Fill the theoretical CDF table from the cached CMF of the model
+		cdf.reserve (values.size());
+		for (const auto x : values)
+			cdf.push_back (model.CachedCDF (x));
+
+		// Build the fast lookup index for the values
+		lookup = LookupIndex (values);
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Calculate empirical discrete CDF values                               //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	Every value counts by its weight, if the weights are given
 	void Init (
-		const vector <double> &data		// Empirical data for the calculation
+		const double data[],			// Ranked empirical data
+		const double weights[],			// Weights of the values (or NULL)
+		size_t size						// Data size
 	){
 		// Calculate empirical discrete PDF and CDF values
-		size_t count = 0;
-		size_t total = 0;
+		double count = 0.0;
+		double total = 0.0;
 		double last = data [0];
-		const size_t size = data.size();
-		for (const auto x : data) {
+		for (size_t i = 0; i < size; i++) {
+			const double x = data [i];
+			const double weight = weights ? weights [i] : 1.0;
 
 			// Compare current value with the last one checked
 			if (x != last) {
 
 				// Found another unique value
 				total += count;
-				const double sum = double (total) / double (size);
 				values.push_back (last);
-				cdf.push_back (sum);
-				count = 1;
+				cdf.push_back (total);
+				count = weight;
 			}
 
 			// The same value
-			else count++;
+			else count += weight;
 
 			// Update the last checked value
 			last = x;
@@ -90,9 +114,15 @@ private:
 
 		// Finalize the PDF and CDF tables
 		total += count;
-		const double sum = double (total) / double (size);
 		values.push_back (last);
-		cdf.push_back (sum);
+		cdf.push_back (total);
+
+		// Normalize the cumulative counts by the total one
+		for (auto &sum : cdf)
+			sum /= total;
+
+		// Build the fast lookup index for the values
+		lookup = LookupIndex (values);
 	}
 
 //============================================================================//
@@ -121,15 +151,28 @@ public:
 
 	// Discrete model
 	RawCDF (
-		const Model::BaseDiscrete &model	// Theoretical model
+		const Model::BaseDiscrete &model,	// Theoretical model
+		const vector <double> &values		// Unique values
 	) :	type (THEORETICAL),
-		range (model.DistLocation()),
-		values (range.Linear())
+		range (values),
+		values (values)
 	{
 		// Calculate theoretical CDF values for a discrete model
 		Init (model);
 	}
 
+	// Discrete model
+	RawCDF (
+		const Model::BaseDiscrete &model	// Theoretical model
+	) :	type (THEORETICAL),
+		range (model.DistLocation()),
+		values (range.Linear()),
+		cdf (model.CMF())
+	{
+		// The model location matches its cached CMF table, so copy it as is
+		lookup = LookupIndex (values);
+	}
+
 	// Continuous model
 	RawCDF (
 		const Model::BaseContinuous &model	// Theoretical model
@@ -149,15 +192,12 @@ public:
 	) :	type (EMPIRICAL),
 		range (data.Domain())
 	{
-		// Extract the ranked dataset
-		const vector <double> &temp = data.Data();
-
 		// Check if the dataset is not empty
-		if (temp.empty())
+		if (data.Size() == 0)
 			throw invalid_argument ("RawCDF: There are no empirical observations to calculate the CDF function");
 
-		// Calculate empirical CDF values
-		Init (temp);
+		// Calculate empirical CDF values of the ranked dataset with its weights
+		Init (data.RankedData(), data.RankedWeights(), data.Size());
 	}
 
 	RawCDF (
@@ -173,7 +213,7 @@ public:
 		sort (data.begin(), data.end());
 
 		// Calculate empirical CDF values
-		Init (data);
+		Init (data.data(), NULL, data.size());
 	}
 
 	RawCDF (
@@ -229,10 +269,34 @@ public:
 	) const {
 
 		// Find the greatest element that is still less than or equal to the target value
-		const size_t index = Array::BinSearchLessOrEqual (values.data(), values.size(), x);
+		const size_t index = lookup.Find (values, x);
 		return index != static_cast <size_t> (-1) ? cdf [index] : 0.0;
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Find values of the CDF function for a batch of Х                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> GetCDF (
+		const vector <double> &x		// Argument values
+	) const {
+
+		// Find the greatest elements that are still less than or equal to the target values
+		const vector <size_t> &indices = lookup.Find (values, x);
+
+		// Collect the CDF values
+		vector <double> result;
+		result.reserve (indices.size());
+		for (const auto index : indices)
+			result.push_back (index != static_cast <size_t> (-1) ? cdf [index] : 0.0);
+		return result;
+	}
+
+	vector <double> GetCDF (
+		const pylist &py_list			// Argument values
+	) const {
+		return GetCDF (to_vector (py_list));
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Summary of the object                                                 //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
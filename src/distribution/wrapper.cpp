@@ -12,6 +12,7 @@
 # include	"bins.hpp"
 # include	"raw.hpp"
 # include	"distribution.hpp"
+# include	"kde.hpp"
 # include	"cdf.hpp"
 # include	"comparator.hpp"
 
@@ -61,6 +62,8 @@ BOOST_PYTHON_MODULE (distribution) {
 //============================================================================//
 //      Expose "RawCDF" class to Python                                       //
 //============================================================================//
+double (RawCDF::*RawGetCDF1)(double x) const								= &RawCDF::GetCDF;
+vector <double> (RawCDF::*RawGetCDF2)(const pylist &py_list) const			= &RawCDF::GetCDF;
 	class_ <RawCDF> ("RawCDF",
 		"Calculate a raw cdf function",
 		init <> ())
@@ -86,8 +89,10 @@ BOOST_PYTHON_MODULE (distribution) {
 			"Unique values in the dataset")
 		.def ("CDF",			&RawCDF::CDF,		return_internal_reference <> (),
 			"Values of the CDF function for the dataset")
-		.def ("GetCDF",			&RawCDF::GetCDF, args ("x"),
+		.def ("GetCDF",			RawGetCDF1, args ("x"),
 			"Find a value of the CDF function for an arbitrary Х")
+		.def ("GetCDF",			RawGetCDF2, args ("x"),
+			"Find values of the CDF function for a batch of Х")
 		.def (self_ns::str (self_ns::self))
 
 		// Properties
@@ -97,6 +102,10 @@ BOOST_PYTHON_MODULE (distribution) {
 //============================================================================//
 //      Expose "Distribution" class to Python                                 //
 //============================================================================//
+double (Distribution::*GetCDF1)(double x) const								= &Distribution::GetCDF;
+vector <double> (Distribution::*GetCDF2)(const pylist &py_list) const		= &Distribution::GetCDF;
+double (Distribution::*GetPDF1)(double x) const								= &Distribution::GetPDF;
+vector <double> (Distribution::*GetPDF2)(const pylist &py_list) const		= &Distribution::GetPDF;
 	class_ <Distribution> ("Distribution",
 		"Calculate pdf and cdf functions for a distribution",
 		init <> ())
@@ -132,22 +141,89 @@ BOOST_PYTHON_MODULE (distribution) {
 			"Values of the PDF function for the dataset")
 		.def ("SmoothedPDF",	&Distribution::SmoothedPDF,	args ("points"),
 			"Smoothed values of the CDF function for the dataset")
-		.def ("GetCDF",			&Distribution::GetCDF, args ("x"),
+		.def ("GetCDF",			GetCDF1, args ("x"),
 			"Find a value of the CDF function for an arbitrary Х")
-		.def ("GetPDF",			&Distribution::GetPDF, args ("x"),
+		.def ("GetCDF",			GetCDF2, args ("x"),
+			"Find values of the CDF function for a batch of Х")
+		.def ("GetPDF",			GetPDF1, args ("x"),
 			"Find a value of the PDF function for an arbitrary Х")
+		.def ("GetPDF",			GetPDF2, args ("x"),
+			"Find values of the PDF function for a batch of Х")
 		.def (self_ns::str (self_ns::self))
 
 		// Properties
 		.add_property ("Bins",	&Distribution::Bins,
 			"Bins count the distribution function is split into");
 
+//============================================================================//
+//      Expose "KernelDensity" class to Python                                //
+//============================================================================//
+	enum_ <KernelDensity::KernelType> ("KernelType")
+		.value ("GAUSSIAN",		KernelDensity::GAUSSIAN)
+		.value ("EPANECHNIKOV",	KernelDensity::EPANECHNIKOV);
+
+	enum_ <KernelDensity::BandwidthType> ("BandwidthType")
+		.value ("SILVERMAN",	KernelDensity::SILVERMAN)
+		.value ("SCOTT",		KernelDensity::SCOTT)
+		.value ("PLUGIN",		KernelDensity::PLUGIN);
+
+KernelDensity::KernelType (KernelDensity::*Kernel)(void) const					= &KernelDensity::Kernel;
+double (KernelDensity::*Bandwidth)(void) const									= &KernelDensity::Bandwidth;
+double (KernelDensity::*KernelGetPDF1)(double x) const							= &KernelDensity::GetPDF;
+vector <double> (KernelDensity::*KernelGetPDF2)(const pylist &py_list) const	= &KernelDensity::GetPDF;
+	class_ <KernelDensity> ("KernelDensity",
+		"Kernel density estimation",
+		init <const pylist&, KernelDensity::KernelType, KernelDensity::BandwidthType, size_t>
+			(args ("data", "kernel", "selector", "points"),
+			"Estimate the density with the bandwidth selection"))
+		.def (init <const Observations&, KernelDensity::KernelType, KernelDensity::BandwidthType, size_t>
+			(args ("data", "kernel", "selector", "points"),
+			"Estimate the density with the bandwidth selection"))
+		.def (init <const pylist&, const Model::Range&, KernelDensity::KernelType, KernelDensity::BandwidthType, size_t>
+			(args ("data", "domain", "kernel", "selector", "points"),
+			"Estimate the density in a bounded domain with the bandwidth selection"))
+		.def (init <const Observations&, const Model::Range&, KernelDensity::KernelType, KernelDensity::BandwidthType, size_t>
+			(args ("data", "domain", "kernel", "selector", "points"),
+			"Estimate the density in a bounded domain with the bandwidth selection"))
+		.def (init <const pylist&, const Model::Range&, KernelDensity::KernelType, double, size_t>
+			(args ("data", "domain", "kernel", "bandwidth", "points"),
+			"Estimate the density in a bounded domain with the bandwidth provided"))
+		.def (init <const Observations&, const Model::Range&, KernelDensity::KernelType, double, size_t>
+			(args ("data", "domain", "kernel", "bandwidth", "points"),
+			"Estimate the density in a bounded domain with the bandwidth provided"))
+
+		// Methods
+		.def ("Domain",			&KernelDensity::Domain,	return_internal_reference <> (),
+			"Domain of the random value")
+		.def ("Values",			&KernelDensity::Values,	return_internal_reference <> (),
+			"Grid points")
+		.def ("PDF",			&KernelDensity::PDF,	return_internal_reference <> (),
+			"Estimated density at the grid points")
+		.def ("GetPDF",			KernelGetPDF1, args ("x"),
+			"Estimated density for an arbitrary Х")
+		.def ("GetPDF",			KernelGetPDF2, args ("x"),
+			"Estimated density for a batch of Х")
+		.def (self_ns::str (self_ns::self))
+
+		// Properties
+		.add_property ("Kernel",	Kernel,
+			"Kernel type")
+		.add_property ("Bandwidth",	Bandwidth,
+			"Kernel bandwidth");
+
 //============================================================================//
 //      Expose "CDF" class to Python                                          //
 //============================================================================//
 void (CDF::*ReferenceSample1)(const pylist &py_list)		= &CDF::ReferenceSample;
 void (CDF::*ReferenceSample2)(const vector <double> &data)	= &CDF::ReferenceSample;
 void (CDF::*ReferenceSample3)(const Observations &data)		= &CDF::ReferenceSample;
+void (CDF::*CDFReferenceModel1)(const Model::BaseModel &model)		= &CDF::ReferenceModel;
+void (CDF::*CDFReferenceModel2)(const Model::BaseDiscrete &model)	= &CDF::ReferenceModel;
+const KolmogorovScoreTable (*ScoreTable1)(const Observations &data)	= &CDF::ScoreTable;
+const KolmogorovScoreTable (*ScoreTable2)(const Observations &data, Model::Likelihood::EstimatorType estimator)	= &CDF::ScoreTable;
+const KolmogorovScoreTable (*ScoreTable3)(const Observations &data, Model::Likelihood::EstimatorType estimator, bool mixtures)	= &CDF::ScoreTable;
+const KolmogorovScoreTable (*BootstrapScoreTable1)(const Observations &data, size_t replicates, double alpha, size_t seed)	= &CDF::BootstrapScoreTable;
+const KolmogorovScoreTable (*BootstrapScoreTable2)(const Observations &data, size_t replicates, double alpha, size_t seed, Model::Likelihood::EstimatorType estimator)	= &CDF::BootstrapScoreTable;
 	class_ <CDF> ("CDF",
 		"Compare two cdf functions with one another",
 		init <const pylist&> (args ("data"),
@@ -195,7 +271,9 @@ void (CDF::*ReferenceSample3)(const Observations &data)		= &CDF::ReferenceSample
 			"Load another sample as a reference for the distribution test")
 		.def ("ReferenceSample",			ReferenceSample3,		args ("data"),
 			"Load another sample as a reference for the distribution test")
-		.def ("ReferenceModel",				&CDF::ReferenceModel,	args ("model"),
+		.def ("ReferenceModel",				CDFReferenceModel1,		args ("model"),
+			"Load a distribution model as a reference for the distribution test")
+		.def ("ReferenceModel",				CDFReferenceModel2,		args ("model"),
 			"Load a distribution model as a reference for the distribution test")
 		.def ("Sample",						&CDF::Sample,
 			return_value_policy <copy_const_reference> (),
@@ -207,18 +285,32 @@ void (CDF::*ReferenceSample3)(const Observations &data)		= &CDF::ReferenceSample
 			"Confidence level of the one-sample Kolmogorov-Smirnov test")
 		.def ("KolmogorovSmirnovTest",		&CDF::KolmogorovSmirnovTest,
 			"Perform the one-sample or two-sample Kolmogorov-Smirnov test")
-		.def ("ScoreTable",					&CDF::ScoreTable,
+		.def ("ScoreTable",					ScoreTable1,			args ("data"),
 			"Score table (confidence level) for different distribution models")
+		.def ("ScoreTable",					ScoreTable2,			args ("data", "estimator"),
+			"Score table (confidence level) for different distribution models fitted by the estimator")
+		.def ("ScoreTable",					ScoreTable3,			args ("data", "estimator", "mixtures"),
+			"Score table (confidence level) for different distribution models including the mixture models on request")
+		.def ("BootstrapScoreTable",		BootstrapScoreTable1,
+			args ("data", "replicates", "alpha", "seed"),
+			"Bootstrap score table (confidence level) for different distribution models")
+		.def ("BootstrapScoreTable",		BootstrapScoreTable2,
+			args ("data", "replicates", "alpha", "seed", "estimator"),
+			"Bootstrap score table (confidence level) for different distribution models fitted by the estimator")
 		.def (self_ns::str (self_ns::self))
 
 		// Static methods
-		.staticmethod ("ScoreTable");
+		.staticmethod ("ScoreTable")
+		.staticmethod ("BootstrapScoreTable");
 
 //============================================================================//
 //      Expose "DistComparator" class to Python                               //
 //============================================================================//
 void (DistComparator::*ReferenceModel1)(const Model::BaseDiscrete &model)	= &DistComparator::ReferenceModel;
 void (DistComparator::*ReferenceModel2)(const Model::BaseContinuous &model)	= &DistComparator::ReferenceModel;
+double (DistComparator::*PearsonConfidenceLevel1)(void) const				= &DistComparator::PearsonConfidenceLevel;
+double (DistComparator::*PearsonConfidenceLevel2)(const pylist &py_list) const	= &DistComparator::PearsonConfidenceLevel;
+double (DistComparator::*PearsonConfidenceLevel3)(const Observations &batch) const	= &DistComparator::PearsonConfidenceLevel;
 	class_ <DistComparator> ("DistComparator",
 		"Compare two distributions functions with one another",
 		init <const pylist&> (args ("data"),
@@ -265,8 +357,12 @@ void (DistComparator::*ReferenceModel2)(const Model::BaseContinuous &model)	= &D
 		.def ("Reference",					&DistComparator::Reference,
 			return_value_policy <copy_const_reference> (),
 			"Return reference distribution")
-		.def ("PearsonConfidenceLevel",		&DistComparator::PearsonConfidenceLevel,
+		.def ("PearsonConfidenceLevel",		PearsonConfidenceLevel1,
 			"Confidence level of Pearson's chi-squared test")
+		.def ("PearsonConfidenceLevel",		PearsonConfidenceLevel2,	args ("batch"),
+			"Confidence level of Pearson's chi-squared test for a new batch")
+		.def ("PearsonConfidenceLevel",		PearsonConfidenceLevel3,	args ("batch"),
+			"Confidence level of Pearson's chi-squared test for a new batch")
 		.def ("PearsonChiSquaredTest",		&DistComparator::PearsonChiSquaredTest,
 			"Perform the Pearson's chi-squared test")
 		.def ("ScoreTable",					&DistComparator::ScoreTable,
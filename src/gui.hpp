@@ -285,6 +285,30 @@ SHOW_DISTRIBUTION_SUMMARY2 (Laplace)
 SHOW_DISTRIBUTION_SUMMARY1 (AsymmetricLaplace)
 SHOW_DISTRIBUTION_SUMMARY2 (AsymmetricLaplace)
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Normal mixture distribution                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+SHOW_DISTRIBUTION_SUMMARY1 (NormalMixture)
+SHOW_DISTRIBUTION_SUMMARY2 (NormalMixture)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Gamma mixture distribution                                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+SHOW_DISTRIBUTION_SUMMARY1 (GammaMixture)
+SHOW_DISTRIBUTION_SUMMARY2 (GammaMixture)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Laplace mixture distribution                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+SHOW_DISTRIBUTION_SUMMARY1 (LaplaceMixture)
+SHOW_DISTRIBUTION_SUMMARY2 (LaplaceMixture)
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Logistic mixture distribution                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+SHOW_DISTRIBUTION_SUMMARY1 (LogisticMixture)
+SHOW_DISTRIBUTION_SUMMARY2 (LogisticMixture)
+
 //============================================================================//
 //      Statistical population                                                //
 //============================================================================//
@@ -39,30 +39,42 @@ public:
 	virtual ~BaseModel (void) = default;
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-//      Generate random values from the distribution using the seed provided  //
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	vector <double> Generate (
-		size_t count,			// Size of the sample to generate
-		double seed				// The seed value
-	){
-		// The accumulator for random values
-		vector <double> result;
-
-		// Seed the standard Mersenne twister engine
-		mt19937 generator (seed);
+//      Fill the buffer with random values from the distribution              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The default generator translates uniform random values into the
+//			target distribution by the quantile function. Models which have a
+//			faster generator override this method
+	virtual void Fill (
+		double *data,			// Buffer to fill
+		size_t count,			// Count of values to generate
+		mt19937 &generator		// Random number engine
+	) const {
 
 		// Collect uniformly distributed random values in the range [0, 1)
 		uniform_real_distribution <double> uniform (0.0, 1.0);
-		while (count--) {
+		for (size_t i = 0; i < count; i++) {
 
 			// Generate a random number in the range [0..1]
 			const double rnd = uniform (generator);
 
 			// Translate uniform distribution into the target distribution
-			result.push_back (Quantile (rnd));
+			data [i] = Quantile (rnd);
 		}
+	}
 
-		// Return all the generated random values
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Generate random values from the distribution using the seed provided  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> Generate (
+		size_t count,			// Size of the sample to generate
+		double seed				// The seed value
+	){
+		// Seed the standard Mersenne twister engine
+		mt19937 generator (seed);
+
+		// Fill the sample with random values from the distribution
+		vector <double> result (count);
+		Fill (result.data(), count, generator);
 		return result;
 	}
 
@@ -79,6 +91,60 @@ public:
 		return Generate (count, rd());
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Quantile values for the target levels                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual vector <double> Quantiles (
+		const vector <double> &levels	// Target levels
+	) const {
+		// The accumulator for quantile values
+		vector <double> result;
+		result.reserve (levels.size());
+
+		// Find the quantile for every level
+		for (const auto level : levels)
+			result.push_back (Quantile (level));
+
+		// Return all the quantile values
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Probability Density Function (PDF) for the argument values            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual vector <double> PDFs (
+		const vector <double> &values	// Argument values
+	) const {
+		// The accumulator for density values
+		vector <double> result;
+		result.reserve (values.size());
+
+		// Find the density for every argument
+		for (const auto x : values)
+			result.push_back (PDF (x));
+
+		// Return all the density values
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Cumulative Distribution Function (CDF) for the argument values        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual vector <double> CDFs (
+		const vector <double> &values	// Argument values
+	) const {
+		// The accumulator for probability values
+		vector <double> result;
+		result.reserve (values.size());
+
+		// Find the probability for every argument
+		for (const auto x : values)
+			result.push_back (CDF (x));
+
+		// Return all the probability values
+		return result;
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Median of the distribution                                            //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
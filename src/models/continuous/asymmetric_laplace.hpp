@@ -173,6 +173,27 @@ public:
 		}
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Quantile value for the target level                                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double Quantile (
+		double level				// Quantile level to estimate
+	) const override final {
+
+		// Check if the level is correct
+		if (0.0 <= level and level <= 1.0) {
+
+			// Analytic inverse of the CDF function
+			const double temp = asymmetry * asymmetry;
+			if (level < temp / (1.0 + temp))
+				return location + scale * asymmetry * log (level * (1.0 + temp) / temp);
+			else
+				return location - scale / asymmetry * log ((1.0 - level) * (1.0 + temp));
+		}
+		else
+			throw invalid_argument ("Quantile: Level must be in the range [0..1]");
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Mean of the distribution                                              //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -120,6 +120,20 @@ public:
 		return exp (temp) / x;
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Derivative of the PDF function                                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double PDFDerivative (
+		double x				// Argument value
+	) const override final {
+
+		// Outside the open distribution domain
+		if (x <= range.Min()) return NAN;
+
+		// Common case
+		return PDF (x) * ((0.5 * gamma_shape - 1.0) / x - 1.0 / gamma_scale);
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Cumulative Distribution Function (CDF)                                //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -132,11 +146,7 @@ public:
 
 		// Common case
 		const double arg = x / gamma_scale;
-		const size_t count = gamma_shape / 2;
-		if (gamma_shape % 2)
-			return NormalizedLowerIncompleteGammaHalf (arg, count);
-		else
-			return NormalizedLowerIncompleteGamma (arg, count);
+		return NormalizedLowerIncompleteGamma (arg, 0.5 * gamma_shape, gamma_log);
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -160,6 +160,20 @@ public:
 		return exp (temp);
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Derivative of the PDF function                                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double PDFDerivative (
+		double x					// Argument value
+	) const override final {
+
+		// Outside the open distribution domain
+		if (x <= range.Min() || x >= range.Max()) return NAN;
+
+		// Common case
+		return PDF (x) * ((shape1 - 1.0) / x - (shape2 - 1.0) / (1.0 - x));
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Cumulative Distribution Function (CDF)                                //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
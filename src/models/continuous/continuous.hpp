@@ -10,11 +10,11 @@
 # pragma	once
 # include	"../base.hpp"
 
-// Value of the step out of a point where the derivative is infinite
-# define	STEP_OUTSIDE		0.001
+// Maximal count of iterations for the quantile solver
+# define	QUANTILE_ITERATIONS	100
 
-// The number of iterations for the Newton solve method
-# define	NEWTON_ITERATIONS	52
+// Relative tolerance of the quantile solver
+# define	QUANTILE_TOLERANCE	1e-12
 
 // Quantiles to locate theoretical models
 # define	EPSILON				1e-6
@@ -62,53 +62,97 @@ public:
 		return Range (Quantile (MIN_LEVEL), Quantile (MAX_LEVEL));
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Derivative of the PDF function                                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	Models that know the derivative override the function to let the
+//			quantile solver use Halley steps instead of Newton steps
+	virtual double PDFDerivative (
+		double					// Argument value (not used)
+	) const {
+		return NAN;
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Quantile value for the target level                                   //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The solver keeps a bracket around the solution and makes Halley
+//			or Newton steps inside it. A step that leaves the bracket is
+//			replaced by the bisection of the bracket. Models that have
+//			an analytic inverse of the CDF function override the function
 	virtual double Quantile (
 		double level			// Quantile level to estimate
-	) const override final {
+	) const override {
 
 		// Check if the level is correct
 		if (0.0 <= level and level <= 1.0) {
 
-			// Get the distribution domain to clamp the argument value
+			// The bounds of the distribution domain are the initial bracket
 			const Range &range = Domain();
+			double lo = range.Min();
+			double hi = range.Max();
+
+			// The extreme levels are the domain bounds
+			if (level == 0.0) return lo;
+			if (level == 1.0) return hi;
 
 			// The first approximation is the mode value (if it exists),
 			// then the mean value
 			double x = Mode();
 			if (isnan (x)) x = Mean();
-			if (isinf (x)) x = 0.0;
+			if (!isfinite (x)) x = 0.0;
+			x = range.Clamp (x);
 
 			// Get the difference between the function and the target value
 			double diff = CDF (x) - level;
+			if (diff == 0.0) return x;
+
+			// The initial step to expand an infinite bracket
+			double step = StdDev();
+			if (!(step > 0.0 && isfinite (step))) step = 1.0;
+
+			// Expand the bracket until it holds the solution
+			if (diff < 0.0) {
+				lo = x;
+				for (; isinf (hi) && isfinite (lo + step); step *= 2.0) {
+					const double next = lo + step;
+					if (CDF (next) < level) lo = next; else hi = next;
+				}
+			}
+			else {
+				hi = x;
+				for (; isinf (lo) && isfinite (hi - step); step *= 2.0) {
+					const double next = hi - step;
+					if (CDF (next) < level) lo = next; else hi = next;
+				}
+			}
 
-			// Find a solution using the Newton solve method
-			int i = NEWTON_ITERATIONS;
-			while (diff && i--) {
+			// Find a solution inside the bracket
+			for (size_t i = 0; i < QUANTILE_ITERATIONS; i++) {
 
-				// Calculate the function derivative
+				// Newton step, corrected by Halley when the PDF derivative is known
+				double next = NAN;
 				const double der = PDF (x);
-
-				// Calculate a step value to move for the next point
-				double step = diff / der;
-
-				// If the derivative is infinite in the target point
-				// then do a step outside the pit
-				if (der == INFINITY)
-					step = +STEP_OUTSIDE * diff;
-				else if (der == -INFINITY)
-					step = -STEP_OUTSIDE * diff;
-
-				// A new approximation
-				x -= step;
-
-				// Clamp the value inside the distribution domain
-				x = range.Clamp (x);
-
-				// Check the difference for the new function value
+				if (der > 0.0 && isfinite (der)) {
+					double delta = diff / der;
+					const double temp = 0.5 * delta * PDFDerivative (x) / der;
+					if (fabs (temp) < 0.5) delta /= 1.0 - temp;
+					next = x - delta;
+				}
+
+				// Bisection when the step leaves the bracket
+				if (!(lo < next && next < hi)) next = 0.5 * (lo + hi);
+				if (!isfinite (next)) break;
+
+				// Check for the convergence
+				const double tolerance = QUANTILE_TOLERANCE * fabs (next);
+				const bool done = fabs (next - x) <= tolerance || hi - lo <= tolerance;
+
+				// Shrink the bracket using the new approximation
+				x = next;
 				diff = CDF (x) - level;
+				if (diff == 0.0 || done) break;
+				if (diff < 0.0) lo = x; else hi = x;
 			}
 
 			// Return the quantile value
@@ -133,6 +133,23 @@ public:
 		return 1.0 - exp (-arg);
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Quantile value for the target level                                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double Quantile (
+		double level				// Quantile level to estimate
+	) const override final {
+
+		// Check if the level is correct
+		if (0.0 <= level and level <= 1.0) {
+
+			// Analytic inverse of the CDF function
+			return -scale * log1p (-level);
+		}
+		else
+			throw invalid_argument ("Quantile: Level must be in the range [0..1]");
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Mode of the distribution                                              //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
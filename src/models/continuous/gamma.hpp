@@ -127,6 +127,20 @@ public:
 		return exp (temp) / x;
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Derivative of the PDF function                                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double PDFDerivative (
+		double x					// Argument value
+	) const override final {
+
+		// Outside the open distribution domain
+		if (x <= range.Min()) return NAN;
+
+		// Common case
+		return PDF (x) * ((shape - 1.0) / x - 1.0 / scale);
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Cumulative Distribution Function (CDF)                                //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -139,7 +153,7 @@ public:
 
 		// Common case
 		const double arg = x / scale;
-		return NormalizedLowerIncompleteGamma (arg, shape);
+		return NormalizedLowerIncompleteGamma (arg, shape, gamma_log);
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
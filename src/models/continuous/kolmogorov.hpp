@@ -8,11 +8,23 @@
 ################################################################################
 */
 # pragma	once
+# include	<vector>
 # include	"continuous.hpp"
+# include	"../../templates/array.hpp"
 
 // TS elements to compute for PDF and CDF approximation
 # define	KOLMOGOROV_N		6
 
+// Range of the tabulated PDF and CDF functions and the table step
+# define	KOLMOGOROV_MIN		0.5
+# define	KOLMOGOROV_MAX		2.5
+# define	KOLMOGOROV_STEP		(1.0 / 512.0)
+
+// Scale factor the matrix powers of the finite sample distribution are kept
+// below, and its decimal exponent
+# define	KOLMOGOROV_SCALE	1e140
+# define	KOLMOGOROV_EXP		140
+
 // Adjusted distribution moments
 # define	KOLMOGOROV_MEAN		sqrt (M_PI_2) * M_LN2
 # define	KOLMOGOROV_VARIANCE	M_PI_2 * (M_PI / 6 - M_LN2 * M_LN2)
@@ -37,6 +49,9 @@ private:
 	static const size_t params;		// Count of distribution parameters
 	static const double threshold;	// The threshold value to improve precision
 	static const double mode;		// Mode value of the distribution
+	static const vector <double> cdf_table;	// Tabulated CDF function
+	static const vector <double> pdf_table;	// Tabulated PDF function
+	static const vector <double> der_table;	// Tabulated PDF derivative
 
 //============================================================================//
 //      Private methods                                                       //
@@ -174,6 +189,101 @@ private:
 		}
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Calculate the derivative of the PDF function                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double derivative (
+		double x			// Argument value
+	){
+		// Calculate the derivative when x is big
+		if (x >= threshold) {
+			double sum = 0.0;
+			for (int i = 1; i < KOLMOGOROV_N; i++) {
+				const double temp = i * x;
+				const double exponent = -2.0 * temp * temp;
+				const double value = i * i * (1.0 - 4.0 * temp * temp) * exp (exponent);
+				if (i % 2)
+					sum += value;
+				else
+					sum -= value;
+			}
+			return 8.0 * sum;
+		}
+
+		// Calculate the derivative when x is small
+		else {
+			double sum = 0.0;
+			for (int i = 1; i < KOLMOGOROV_N; i++) {
+				const double p = (2.0 * i - 1.0) * M_PI;
+				const double q = 2.0 * x;
+				const double temp = p / q;
+				const double exponent = -0.5 * temp * temp;
+				sum += ((temp * temp - 5.0) * temp * temp + 2.0) * exp (exponent);
+			}
+			return sqrt (2.0 * M_PI) * sum / (x * x * x);
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Tabulate a function on the uniform grid                               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static vector <double> Tabulate (
+		double (*func) (double)	// Function to tabulate
+	){
+		const size_t size = size_t ((KOLMOGOROV_MAX - KOLMOGOROV_MIN) / KOLMOGOROV_STEP) + 1;
+		vector <double> table (size);
+		for (size_t i = 0; i < size; i++)
+			table [i] = func (KOLMOGOROV_MIN + i * KOLMOGOROV_STEP);
+		return table;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Interpolate a tabulated function by the cubic Hermite spline          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// Argument must be inside the table range
+	static double interpolate (
+		const vector <double> &func,	// Tabulated function
+		const vector <double> &der,		// Tabulated derivative of the function
+		double x						// Argument value
+	){
+		// Find the table cell and the position inside it
+		const double pos = (x - KOLMOGOROV_MIN) / KOLMOGOROV_STEP;
+		const size_t i = min (size_t (pos), func.size() - 2);
+		const double t = pos - i;
+
+		// Hermite basis functions
+		const double t2 = t * t;
+		const double t3 = t2 * t;
+		const double h00 = 2.0 * t3 - 3.0 * t2 + 1.0;
+		const double h10 = t3 - 2.0 * t2 + t;
+		const double h01 = 3.0 * t2 - 2.0 * t3;
+		const double h11 = t3 - t2;
+
+		// Combine the values and the derivatives at the cell edges
+		const double p = h00 * func [i] + h01 * func [i + 1];
+		const double q = h10 * der [i] + h11 * der [i + 1];
+		return p + KOLMOGOROV_STEP * q;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Multiply two square matrices                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static vector <double> multiply (
+		const vector <double> &a,		// The first matrix
+		const vector <double> &b,		// The second matrix
+		size_t m						// Size of the matrices
+	){
+		vector <double> c (m * m, 0.0);
+		for (size_t i = 0; i < m; i++)
+			for (size_t k = 0; k < m; k++) {
+				const double temp = a [i * m + k];
+				if (temp == 0.0) continue;
+				for (size_t j = 0; j < m; j++)
+					c [i * m + j] += temp * b [k * m + j];
+			}
+		return c;
+	}
+
 //============================================================================//
 //      Public methods                                                        //
 //============================================================================//
@@ -208,10 +318,28 @@ public:
 		// Below the range
 		if (x <= range) return 0.0;
 
+		// Tabulated range
+		if (KOLMOGOROV_MIN <= x && x <= KOLMOGOROV_MAX)
+			return interpolate (pdf_table, der_table, x);
+
 		// Common case
 		return pdf (x);
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Derivative of the PDF function                                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double PDFDerivative (
+		double x			// Argument value
+	) const override final {
+
+		// Below the range
+		if (x <= range) return 0.0;
+
+		// Common case
+		return derivative (x);
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Cumulative Distribution Function (CDF)                                //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -222,10 +350,142 @@ public:
 		// Below the range
 		if (x <= range) return 0.0;
 
+		// Tabulated range
+		if (KOLMOGOROV_MIN <= x && x <= KOLMOGOROV_MAX)
+			return interpolate (cdf_table, pdf_table, x);
+
 		// Common case
 		return cdf (x);
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Quantile value for the target level                                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The table cell that holds the level is found by the binary search,
+//			then the interpolated CDF function is inverted by Newton steps
+//			inside the cell. Above the table the first term of the series is
+//			inverted analytically, below it the generic solver is used
+	virtual double Quantile (
+		double level			// Quantile level to estimate
+	) const override final {
+
+		// Check if the level is correct
+		if (0.0 <= level and level <= 1.0) {
+
+			// The extreme levels are the domain bounds
+			if (level == 0.0) return range.Min();
+			if (level == 1.0) return range.Max();
+
+			// Above the table
+			if (level > cdf_table.back())
+				return sqrt (0.5 * log (2.0 / (1.0 - level)));
+
+			// Below the table
+			if (level < cdf_table.front())
+				return BaseContinuous::Quantile (level);
+
+			// Find the table cell that holds the level
+			const size_t size = cdf_table.size();
+			const size_t i = min (Array::BinSearchLessOrEqual (cdf_table.data(), size, level), size - 2);
+			const double lo = KOLMOGOROV_MIN + i * KOLMOGOROV_STEP;
+			const double hi = lo + KOLMOGOROV_STEP;
+
+			// The first approximation is the linear interpolation
+			const double temp = (level - cdf_table [i]) / (cdf_table [i + 1] - cdf_table [i]);
+			double x = lo + KOLMOGOROV_STEP * temp;
+
+			// Newton steps on the interpolated CDF function
+			for (size_t j = 0; j < QUANTILE_ITERATIONS; j++) {
+				const double delta = (interpolate (cdf_table, pdf_table, x) - level) / interpolate (pdf_table, der_table, x);
+				x = max (lo, min (hi, x - delta));
+				if (fabs (delta) <= QUANTILE_TOLERANCE * x) break;
+			}
+			return x;
+		}
+		else
+			throw invalid_argument ("Quantile: Level must be in the range [0..1]");
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Exact CDF function of the finite sample Kolmogorov statistic          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	Probability P (D < d) of the one-sample Kolmogorov-Smirnov statistic
+//			D = sup |Fn (x) - F (x)| for the sample size n. This is the matrix
+//			algorithm of Durbin in the form of Marsaglia, Tsang and Wang: the
+//			probability is the central element of the n-th power of a banded
+//			matrix of size 2k - 1, where k = floor (n * d) + 1, times n! / n^n.
+//			The matrix powers are scaled to avoid the overflow. In the far
+//			right tail, where the subtraction from 1 loses all the precision,
+//			the tail approximation of the same authors is used instead
+	static double FiniteCDF (
+		size_t n,			// Sample size
+		double d			// Value of the statistic
+	){
+		// Check the sample size
+		if (n == 0)
+			throw invalid_argument ("FiniteCDF: The sample size must be positive");
+
+		// Trivial values of the statistic
+		if (d <= 0.5 / n) return 0.0;
+		if (d >= 1.0) return 1.0;
+
+		// The right tail
+		const double s = d * d * n;
+		if (s > 7.24 || (s > 3.76 && n > 99))
+			return 1.0 - 2.0 * exp (-(2.000071 + 0.331 / sqrt (n) + 1.409 / n) * s);
+
+		// Size of the matrix and the fractional part of n * d
+		const size_t k = size_t (n * d) + 1;
+		const size_t m = 2 * k - 1;
+		const double h = k - n * d;
+
+		// Fill the matrix H
+		vector <double> matrix (m * m);
+		for (size_t i = 0; i < m; i++)
+			for (size_t j = 0; j < m; j++)
+				matrix [i * m + j] = i + 1 >= j ? 1.0 : 0.0;
+		for (size_t i = 0; i < m; i++) {
+			matrix [i * m] -= pow (h, i + 1);
+			matrix [(m - 1) * m + i] -= pow (h, m - i);
+		}
+		if (2.0 * h > 1.0)
+			matrix [(m - 1) * m] += pow (2.0 * h - 1.0, m);
+		for (size_t i = 0; i < m; i++)
+			for (size_t j = 0; j <= i + 1 && j < m; j++)
+				for (size_t g = 2; g <= i + 1 - j; g++)
+					matrix [i * m + j] /= g;
+
+		// Raise the matrix to the power n by the binary exponentiation
+		vector <double> power = matrix;
+		int exponent = 0;
+		size_t bit = 1;
+		while (bit <= n / 2) bit <<= 1;
+		for (bit >>= 1; bit; bit >>= 1) {
+			power = multiply (power, power, m);
+			exponent *= 2;
+			if (n & bit)
+				power = multiply (matrix, power, m);
+
+			// Scale the matrix down if its central element is too big
+			if (power [(m / 2) * m + m / 2] > KOLMOGOROV_SCALE) {
+				for (auto &value : power)
+					value /= KOLMOGOROV_SCALE;
+				exponent += KOLMOGOROV_EXP;
+			}
+		}
+
+		// Multiply the central element by n! / n^n
+		double result = power [(k - 1) * m + k - 1];
+		for (size_t i = 1; i <= n; i++) {
+			result = result * i / n;
+			if (result < 1.0 / KOLMOGOROV_SCALE) {
+				result *= KOLMOGOROV_SCALE;
+				exponent -= KOLMOGOROV_EXP;
+			}
+		}
+		return result * pow (10.0, exponent);
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Mode of the distribution                                              //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -296,6 +556,9 @@ const Range Kolmogorov::range = Range (0, INFINITY);
 const size_t Kolmogorov::params = 0;
 const double Kolmogorov::threshold = sqrt (M_LN2);
 const double Kolmogorov::mode = Kolmogorov::FindMode();
+const vector <double> Kolmogorov::cdf_table = Kolmogorov::Tabulate (Kolmogorov::cdf);
+const vector <double> Kolmogorov::pdf_table = Kolmogorov::Tabulate (Kolmogorov::pdf);
+const vector <double> Kolmogorov::der_table = Kolmogorov::Tabulate (Kolmogorov::derivative);
 
 //****************************************************************************//
 //      Translate the object to a string                                      //
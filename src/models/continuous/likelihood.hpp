@@ -0,0 +1,753 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#              MAXIMUM LIKELIHOOD ESTIMATORS OF MODEL PARAMETERS               #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<boost/math/special_functions/digamma.hpp>
+# include	<boost/math/special_functions/trigamma.hpp>
+# include	"../discrete/uniform.hpp"
+# include	"../discrete/bernoulli.hpp"
+# include	"../discrete/geometric.hpp"
+# include	"../discrete/poisson.hpp"
+# include	"uniform.hpp"
+# include	"rayleigh.hpp"
+# include	"exponential.hpp"
+# include	"erlang.hpp"
+# include	"chi_squared.hpp"
+# include	"gamma.hpp"
+# include	"pareto.hpp"
+# include	"beta.hpp"
+# include	"logistic.hpp"
+# include	"normal.hpp"
+# include	"laplace.hpp"
+
+// Maximal count of Newton iterations
+# define	MLE_ITERATIONS		100
+
+// Relative precision of the estimated parameters
+# define	MLE_EPSILON			1e-12
+
+//****************************************************************************//
+//      Name space "Model"                                                    //
+//****************************************************************************//
+namespace Model
+{
+//****************************************************************************//
+//      Class "Likelihood"                                                    //
+//****************************************************************************//
+// INFO:	All the estimators reduce the observations to their sufficient
+//			statistics in one pass, so every Newton iteration costs O(1) no
+//			matter how large the dataset is. The Logistic distribution has no
+//			sufficient statistics, so its iterations pass over the data. The
+//			models which have no likelihood estimator here throw an exception
+//			instead of being fitted by another estimator
+class Likelihood
+{
+//============================================================================//
+//      Estimator type                                                        //
+//============================================================================//
+public:
+	enum EstimatorType {
+		MOMENTS,						// Default estimator of the model
+		LIKELIHOOD						// Maximum likelihood estimator
+	};
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Log-likelihood of the Gamma distribution                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double GammaLogLikelihood (
+		double shape,						// Shape of the distribution
+		double scale,						// Scale of the distribution
+		const SufficientStats &stats		// Sufficient statistics of the data
+	){
+		const double n = stats.count;
+		const double t1 = (shape - 1.0) * stats.sum_log - stats.sum / scale;
+		const double t2 = n * (shape * log (scale) + lgamma (shape));
+		return t1 - t2;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Score and Hessian of the Gamma distribution for the shape             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The scale is profiled out as the mean divided by the shape, so
+//			the functions belong to the profile likelihood of the shape
+	static void GammaScore (
+		double shape,						// Shape of the distribution
+		const SufficientStats &stats,		// Sufficient statistics of the data
+		double &score,						// Derivative of the log-likelihood
+		double &hessian						// Second derivative of the log-likelihood
+	){
+		const double n = stats.count;
+		const double temp = log (stats.sum / n) - stats.sum_log / n;
+		score = n * (log (shape) - boost::math::digamma (shape) - temp);
+		hessian = n * (1.0 / shape - boost::math::trigamma (shape));
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Maximum likelihood shape of the Gamma distribution                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The shape depends on the mean value and the mean logarithm only, so
+//			the same solver serves the plain and the weighted observations
+	static double GammaShape (
+		double mean,						// Mean value of the data
+		double mean_log						// Mean logarithm of the data
+	){
+		// Check if the shape exists for the data
+		const double temp = log (mean) - mean_log;
+		if (!(temp > 0.0 && isfinite (temp)))
+			throw invalid_argument ("Gamma likelihood: Can not estimate the shape value for the dataset");
+
+		// Initial approximation of the shape (Minka)
+		double shape = (3.0 - temp + sqrt ((temp - 3.0) * (temp - 3.0) + 24.0 * temp)) / (12.0 * temp);
+
+		// Newton iterations for the shape
+		const SufficientStats stats {1, mean, 0.0, 0.0, mean_log, 0.0};
+		for (size_t i = 0; i < MLE_ITERATIONS; i++) {
+			double score, hessian;
+			GammaScore (shape, stats, score, hessian);
+			double next = shape - score / hessian;
+			if (!(next > 0.0)) next = 0.5 * shape;
+			const bool done = fabs (next - shape) <= MLE_EPSILON * shape;
+			shape = next;
+			if (done) break;
+		}
+		return shape;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Inverse of the digamma function                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The initial approximation is by Minka, then the Newton iterations
+//			refine it. The digamma function grows and is concave, so after the
+//			first step the iterations approach the root from the right side
+	static double InverseDigamma (
+		double value						// Value of the digamma function
+	){
+		double x = value >= -2.22 ? exp (value) + 0.5 : -1.0 / (value + 0.5772156649015329);
+		for (size_t i = 0; i < MLE_ITERATIONS; i++) {
+			double next = x - (boost::math::digamma (x) - value) / boost::math::trigamma (x);
+			if (!(next > 0.0)) next = 0.5 * x;
+			const bool done = fabs (next - x) <= MLE_EPSILON * x;
+			x = next;
+			if (done) break;
+		}
+		return x;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Log-likelihood of the Beta distribution                               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double BetaLogLikelihood (
+		double shape1,						// The first shape parameter
+		double shape2,						// The second shape parameter
+		const SufficientStats &stats		// Sufficient statistics of the data
+	){
+		const double n = stats.count;
+		const double t1 = (shape1 - 1.0) * stats.sum_log + (shape2 - 1.0) * stats.sum_log1m;
+		const double t2 = lgamma (shape1) + lgamma (shape2) - lgamma (shape1 + shape2);
+		return t1 - n * t2;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Score and Hessian of the Beta distribution                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static void BetaScore (
+		double shape1,						// The first shape parameter
+		double shape2,						// The second shape parameter
+		const SufficientStats &stats,		// Sufficient statistics of the data
+		double score[2],					// Gradient of the log-likelihood
+		double hessian[3]					// Hessian matrix (11, 12, 22 elements)
+	){
+		const double n = stats.count;
+		const double psi = boost::math::digamma (shape1 + shape2);
+		const double tri = boost::math::trigamma (shape1 + shape2);
+		score[0] = stats.sum_log + n * (psi - boost::math::digamma (shape1));
+		score[1] = stats.sum_log1m + n * (psi - boost::math::digamma (shape2));
+		hessian[0] = n * (tri - boost::math::trigamma (shape1));
+		hessian[1] = n * tri;
+		hessian[2] = n * (tri - boost::math::trigamma (shape2));
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Log-likelihood of the Logistic distribution for weighted values       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double LogisticLogLikelihood (
+		double location,					// Location of the distribution
+		double scale,						// Scale of the distribution
+		const double values[],				// Values
+		const double weights[],				// Weights of the values
+		size_t size							// Count of the values
+	){
+		double result = 0.0;
+		for (size_t i = 0; i < size; i++) {
+			const double z = fabs (values [i] - location) / scale;
+			result -= weights [i] * (z + 2.0 * log1p (exp (-z)) + log (scale));
+		}
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Score and Hessian of the Logistic distribution for weighted values    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The distribution has no sufficient statistics, so the functions
+//			pass over all the values
+	static void LogisticScore (
+		double location,					// Location of the distribution
+		double scale,						// Scale of the distribution
+		const double values[],				// Values
+		const double weights[],				// Weights of the values
+		size_t size,						// Count of the values
+		double score[2],					// Gradient of the log-likelihood
+		double hessian[3]					// Hessian matrix (11, 12, 22 elements)
+	){
+		double s1 = 0.0, s2 = 0.0;
+		double h1 = 0.0, h2 = 0.0, h3 = 0.0;
+		for (size_t i = 0; i < size; i++) {
+			const double z = (values [i] - location) / scale;
+			const double p = 1.0 / (1.0 + exp (-z));
+			const double d = 2.0 * p - 1.0;
+			const double c = 2.0 * p * (1.0 - p);
+			const double w = weights [i];
+			s1 += w * d;
+			s2 += w * (d * z - 1.0);
+			h1 += w * c;
+			h2 += w * (c * z + d);
+			h3 += w * (c * z * z + 2.0 * d * z - 1.0);
+		}
+		const double factor = 1.0 / (scale * scale);
+		score[0] = s1 / scale;
+		score[1] = s2 / scale;
+		hessian[0] = -h1 * factor;
+		hessian[1] = -h2 * factor;
+		hessian[2] = -h3 * factor;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Maximum likelihood estimation of the model                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The models which have no likelihood estimator throw an exception,
+//			so the score tables skip them for the likelihood estimator
+	template <typename T>
+	static T Fit (
+		const Observations&					// Empirical observations (not used)
+	){
+		throw invalid_argument ("Likelihood: The model has no maximum likelihood estimator");
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Maximum likelihood estimation of the model for weighted values        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The values must be sorted in ascending order. The weights are not
+//			required to sum to 1. The estimators serve the M-step of the EM
+//			algorithm for mixture models
+	template <typename T>
+	static T WeightedFit (
+		const double values[],				// Sorted values
+		const double weights[],				// Weights of the values
+		size_t size							// Count of the values
+	);
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Weighted mean and variance of the values                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static void WeightedMoments (
+		const double values[],				// Values
+		const double weights[],				// Weights of the values
+		size_t size,						// Count of the values
+		double &mean,						// Weighted mean value
+		double &variance					// Weighted variance
+	){
+		// Weighted mean value
+		double total = 0.0;
+		double sum = 0.0;
+		for (size_t i = 0; i < size; i++) {
+			total += weights [i];
+			sum += weights [i] * values [i];
+		}
+		mean = sum / total;
+
+		// Weighted variance around the mean
+		double sum_sqr_dev = 0.0;
+		for (size_t i = 0; i < size; i++) {
+			const double dev = values [i] - mean;
+			sum_sqr_dev += weights [i] * dev * dev;
+		}
+		variance = sum_sqr_dev / total;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Estimation of the model by the chosen estimator                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename T>
+	static T Estimate (
+		const Observations &data,			// Empirical observations
+		EstimatorType estimator				// Estimator type
+	){
+		if (estimator == LIKELIHOOD)
+			return Fit <T> (data);
+		else
+			return T (data);
+	}
+};
+
+//****************************************************************************//
+//      Maximum likelihood estimators of the models                           //
+//****************************************************************************//
+
+//============================================================================//
+//      Discrete uniform distribution                                         //
+//============================================================================//
+// NOTE:	The likelihood is the highest for the smallest range which covers
+//			the data, so the default estimator is the likelihood one. The same
+//			holds for the other models below which are fitted by default
+template <>
+inline DiscreteUniform Likelihood::Fit <DiscreteUniform> (
+	const Observations &data				// Empirical observations
+){
+	return DiscreteUniform (data);
+}
+
+//============================================================================//
+//      Bernoulli distribution                                                //
+//============================================================================//
+template <>
+inline Bernoulli Likelihood::Fit <Bernoulli> (
+	const Observations &data				// Empirical observations
+){
+	return Bernoulli (data);
+}
+
+//============================================================================//
+//      Geometric distribution                                                //
+//============================================================================//
+template <>
+inline Geometric Likelihood::Fit <Geometric> (
+	const Observations &data				// Empirical observations
+){
+	return Geometric (data);
+}
+
+//============================================================================//
+//      Poisson distribution                                                  //
+//============================================================================//
+template <>
+inline Poisson Likelihood::Fit <Poisson> (
+	const Observations &data				// Empirical observations
+){
+	return Poisson (data);
+}
+
+//============================================================================//
+//      Continuous uniform distribution                                       //
+//============================================================================//
+template <>
+inline ContinuousUniform Likelihood::Fit <ContinuousUniform> (
+	const Observations &data				// Empirical observations
+){
+	return ContinuousUniform (data);
+}
+
+//============================================================================//
+//      Exponential distribution                                              //
+//============================================================================//
+template <>
+inline Exponential Likelihood::Fit <Exponential> (
+	const Observations &data				// Empirical observations
+){
+	// Check if empirical data range is inside the model domain
+	if (!Exponential::InDomain (data.Domain()))
+		throw invalid_argument ("Exponential likelihood: The data range is outside the distribution domain");
+
+	// The scale is the mean value
+	const SufficientStats stats = data.Sufficient (SufficientStats::SUM);
+	return Exponential (stats.sum / stats.count);
+}
+
+//============================================================================//
+//      Rayleigh distribution                                                 //
+//============================================================================//
+template <>
+inline Rayleigh Likelihood::Fit <Rayleigh> (
+	const Observations &data				// Empirical observations
+){
+	// Check if empirical data range is inside the model domain
+	if (!Rayleigh::InDomain (data.Domain()))
+		throw invalid_argument ("Rayleigh likelihood: The data range is outside the distribution domain");
+
+	// The squared scale is a half of the mean square
+	const SufficientStats stats = data.Sufficient (SufficientStats::SUM | SufficientStats::SQR_DEV);
+	const double n = stats.count;
+	const double mean = stats.sum / n;
+	return Rayleigh (sqrt (0.5 * (stats.sum_sqr_dev / n + mean * mean)));
+}
+
+//============================================================================//
+//      Gamma distribution                                                    //
+//============================================================================//
+template <>
+inline Gamma Likelihood::Fit <Gamma> (
+	const Observations &data				// Empirical observations
+){
+	// Check if empirical data range is inside the model domain
+	if (!Gamma::InDomain (data.Domain()))
+		throw invalid_argument ("Gamma likelihood: The data range is outside the distribution domain");
+
+	// Extract the sufficient statistics of the observations
+	const SufficientStats stats = data.Sufficient (SufficientStats::SUM | SufficientStats::LOG);
+	const double n = stats.count;
+	const double mean = stats.sum / n;
+
+	// Create the distribution model
+	const double shape = GammaShape (mean, stats.sum_log / n);
+	return Gamma (shape, mean / shape);
+}
+
+//============================================================================//
+//      Erlang distribution                                                   //
+//============================================================================//
+// NOTE:	The profile likelihood of the shape is concave, so the best integer
+//			shape is one of the neighbours of the best real shape
+template <>
+inline Erlang Likelihood::Fit <Erlang> (
+	const Observations &data				// Empirical observations
+){
+	// Check if empirical data range is inside the model domain
+	if (!Erlang::InDomain (data.Domain()))
+		throw invalid_argument ("Erlang likelihood: The data range is outside the distribution domain");
+
+	// Extract the sufficient statistics of the observations
+	const SufficientStats stats = data.Sufficient (SufficientStats::SUM | SufficientStats::LOG);
+	const double n = stats.count;
+	const double mean = stats.sum / n;
+
+	// Choose the better of the integer shapes around the real one
+	const double shape = GammaShape (mean, stats.sum_log / n);
+	const double lower = max (floor (shape), 1.0);
+	const double upper = max (ceil (shape), 1.0);
+	const double value1 = GammaLogLikelihood (lower, mean / lower, stats);
+	const double value2 = GammaLogLikelihood (upper, mean / upper, stats);
+	const double best = value2 > value1 ? upper : lower;
+
+	// Create the distribution model
+	return Erlang (size_t (best), mean / best);
+}
+
+//============================================================================//
+//      Chi-squared distribution                                              //
+//============================================================================//
+// NOTE:	The distribution is the Gamma one with the scale 2 and a half of the
+//			degrees of freedom as the shape. The likelihood is concave in the
+//			degrees of freedom, so the best integer value is one of the
+//			neighbours of the real root of the likelihood equation
+template <>
+inline ChiSquared Likelihood::Fit <ChiSquared> (
+	const Observations &data				// Empirical observations
+){
+	// Check if empirical data range is inside the model domain
+	if (!ChiSquared::InDomain (data.Domain()))
+		throw invalid_argument ("Chi-squared likelihood: The data range is outside the distribution domain");
+
+	// Extract the sufficient statistics of the observations
+	const SufficientStats stats = data.Sufficient (SufficientStats::SUM | SufficientStats::LOG);
+	const double mean_log = stats.sum_log / stats.count;
+	if (!isfinite (mean_log))
+		throw invalid_argument ("Chi-squared likelihood: Can not estimate the degrees of freedom for the dataset");
+
+	// Choose the better of the integer values around the real one
+	const double df = 2.0 * InverseDigamma (mean_log - M_LN2);
+	const double lower = max (floor (df), 1.0);
+	const double upper = max (ceil (df), 1.0);
+	const double value1 = GammaLogLikelihood (0.5 * lower, 2.0, stats);
+	const double value2 = GammaLogLikelihood (0.5 * upper, 2.0, stats);
+	const double best = value2 > value1 ? upper : lower;
+
+	// Create the distribution model
+	return ChiSquared (size_t (best));
+}
+
+//============================================================================//
+//      Pareto distribution                                                   //
+//============================================================================//
+template <>
+inline Pareto Likelihood::Fit <Pareto> (
+	const Observations &data				// Empirical observations
+){
+	// The scale is the smallest observation
+	const double scale = data.Domain().Min();
+	if (!(scale > 0.0))
+		throw invalid_argument ("Pareto likelihood: The data range is outside the distribution domain");
+
+	// Find the shape for the scale
+	const SufficientStats stats = data.Sufficient (SufficientStats::LOG);
+	const double temp = stats.sum_log - stats.count * log (scale);
+	if (!(temp > 0.0))
+		throw invalid_argument ("Pareto likelihood: Can not estimate the shape value for the dataset");
+	return Pareto (stats.count / temp, scale);
+}
+
+//============================================================================//
+//      Beta distribution                                                     //
+//============================================================================//
+template <>
+inline Beta Likelihood::Fit <Beta> (
+	const Observations &data				// Empirical observations
+){
+	// Check if empirical data range is inside the model domain
+	if (!Beta::InDomain (data.Domain()))
+		throw invalid_argument ("Beta likelihood: The data range is outside the distribution domain");
+
+	// Extract the sufficient statistics of the observations
+	const SufficientStats stats = data.Sufficient (SufficientStats::ALL & ~SufficientStats::ABS_DEV);
+	if (!isfinite (stats.sum_log) || !isfinite (stats.sum_log1m))
+		throw invalid_argument ("Beta likelihood: The data must not contain the range bounds");
+
+	// Initial approximation of the shapes by the method of moments
+	const double n = stats.count;
+	const double mean = stats.sum / n;
+	const double variance = stats.sum_sqr_dev / n;
+	const double factor = mean * (1.0 - mean) / variance - 1.0;
+	double shape1 = factor > 0.0 ? mean * factor : 1.0;
+	double shape2 = factor > 0.0 ? (1.0 - mean) * factor : 1.0;
+	double value = BetaLogLikelihood (shape1, shape2, stats);
+
+	// Damped Newton iterations for the shapes
+	for (size_t i = 0; i < MLE_ITERATIONS; i++) {
+
+		// Solve the Newton system for the step
+		double score[2], hessian[3];
+		BetaScore (shape1, shape2, stats, score, hessian);
+		const double det = hessian[0] * hessian[2] - hessian[1] * hessian[1];
+		double step1 = (hessian[1] * score[1] - hessian[2] * score[0]) / det;
+		double step2 = (hessian[1] * score[0] - hessian[0] * score[1]) / det;
+
+		// Keep the shapes positive and the likelihood growing
+		double next1 = shape1 + step1;
+		double next2 = shape2 + step2;
+		double next = next1 > 0.0 && next2 > 0.0 ? BetaLogLikelihood (next1, next2, stats) : NAN;
+		while (!(next >= value) && fabs (step1) + fabs (step2) > MLE_EPSILON * (shape1 + shape2)) {
+			step1 *= 0.5;
+			step2 *= 0.5;
+			next1 = shape1 + step1;
+			next2 = shape2 + step2;
+			next = next1 > 0.0 && next2 > 0.0 ? BetaLogLikelihood (next1, next2, stats) : NAN;
+		}
+		if (!(next >= value)) break;
+
+		// Check for the convergence
+		const bool done = fabs (step1) <= MLE_EPSILON * shape1 && fabs (step2) <= MLE_EPSILON * shape2;
+		shape1 = next1;
+		shape2 = next2;
+		value = next;
+		if (done) break;
+	}
+
+	// Create the distribution model
+	return Beta (shape1, shape2);
+}
+
+//============================================================================//
+//      Logistic distribution                                                 //
+//============================================================================//
+// The weighted estimator is defined below with the other weighted ones
+template <>
+inline Logistic Likelihood::WeightedFit <Logistic> (
+	const double values[],					// Sorted values
+	const double weights[],					// Weights of the values
+	size_t size								// Count of the values
+);
+
+template <>
+inline Logistic Likelihood::Fit <Logistic> (
+	const Observations &data				// Empirical observations
+){
+	const vector <double> weights = data.Weights();
+	return WeightedFit <Logistic> (data.RankedData(), weights.data(), data.Size());
+}
+
+//============================================================================//
+//      Normal distribution                                                   //
+//============================================================================//
+template <>
+inline Normal Likelihood::Fit <Normal> (
+	const Observations &data				// Empirical observations
+){
+	// The location is the mean and the scale is the standard deviation
+	const SufficientStats stats = data.Sufficient (SufficientStats::SUM | SufficientStats::SQR_DEV);
+	const double scale = sqrt (stats.sum_sqr_dev / stats.count);
+	if (!(scale > 0.0))
+		throw invalid_argument ("Normal likelihood: Can not estimate the scale value for the dataset");
+	return Normal (stats.sum / stats.count, scale);
+}
+
+//============================================================================//
+//      Laplace distribution                                                  //
+//============================================================================//
+template <>
+inline Laplace Likelihood::Fit <Laplace> (
+	const Observations &data				// Empirical observations
+){
+	// The location is the median and the scale is the mean absolute deviation
+	const SufficientStats stats = data.Sufficient (SufficientStats::ABS_DEV);
+	const double scale = stats.sum_abs_dev / stats.count;
+	if (!(scale > 0.0))
+		throw invalid_argument ("Laplace likelihood: Can not estimate the scale value for the dataset");
+	return Laplace (data.Median(), scale);
+}
+
+//****************************************************************************//
+//      Weighted maximum likelihood estimators of the models                  //
+//****************************************************************************//
+
+//============================================================================//
+//      Gamma distribution                                                    //
+//============================================================================//
+template <>
+inline Gamma Likelihood::WeightedFit <Gamma> (
+	const double values[],					// Sorted values
+	const double weights[],					// Weights of the values
+	size_t size								// Count of the values
+){
+	// Weighted means of the values and their logarithms
+	double total = 0.0;
+	double sum = 0.0;
+	double sum_log = 0.0;
+	for (size_t i = 0; i < size; i++) {
+		total += weights [i];
+		sum += weights [i] * values [i];
+		sum_log += weights [i] * log (values [i]);
+	}
+	const double mean = sum / total;
+
+	// Create the distribution model
+	const double shape = GammaShape (mean, sum_log / total);
+	return Gamma (shape, mean / shape);
+}
+
+//============================================================================//
+//      Logistic distribution                                                 //
+//============================================================================//
+// NOTE:	The likelihood equations of the Logistic distribution have no closed
+//			form, so they are solved by the damped Newton iterations started
+//			from the weighted moments. If the Hessian is not negative definite
+//			far from the maximum, then the step goes along the score instead
+template <>
+inline Logistic Likelihood::WeightedFit <Logistic> (
+	const double values[],					// Sorted values
+	const double weights[],					// Weights of the values
+	size_t size								// Count of the values
+){
+	// Initial approximation by the method of moments
+	double location, variance;
+	WeightedMoments (values, weights, size, location, variance);
+	double scale = sqrt (3.0 * variance) / M_PI;
+	if (!(scale > 0.0))
+		throw invalid_argument ("Logistic likelihood: Can not estimate the scale value for the dataset");
+	double total = 0.0;
+	for (size_t i = 0; i < size; i++)
+		total += weights [i];
+	double value = LogisticLogLikelihood (location, scale, values, weights, size);
+
+	// Damped Newton iterations for the location and the scale
+	for (size_t i = 0; i < MLE_ITERATIONS; i++) {
+
+		// Solve the Newton system for the step
+		double score[2], hessian[3];
+		LogisticScore (location, scale, values, weights, size, score, hessian);
+		const double det = hessian[0] * hessian[2] - hessian[1] * hessian[1];
+		double step1 = (hessian[1] * score[1] - hessian[2] * score[0]) / det;
+		double step2 = (hessian[1] * score[0] - hessian[0] * score[1]) / det;
+		if (!(hessian[0] < 0.0 && det > 0.0)) {
+			step1 = score[0] * scale * scale / total;
+			step2 = score[1] * scale * scale / total;
+		}
+
+		// Keep the scale positive and the likelihood growing
+		double next1 = location + step1;
+		double next2 = scale + step2;
+		double next = next2 > 0.0 ? LogisticLogLikelihood (next1, next2, values, weights, size) : NAN;
+		while (!(next >= value) && fabs (step1) + fabs (step2) > MLE_EPSILON * (fabs (location) + scale)) {
+			step1 *= 0.5;
+			step2 *= 0.5;
+			next1 = location + step1;
+			next2 = scale + step2;
+			next = next2 > 0.0 ? LogisticLogLikelihood (next1, next2, values, weights, size) : NAN;
+		}
+		if (!(next >= value)) break;
+
+		// Check for the convergence
+		const bool done = fabs (step1) <= MLE_EPSILON * (fabs (location) + scale) && fabs (step2) <= MLE_EPSILON * scale;
+		location = next1;
+		scale = next2;
+		value = next;
+		if (done) break;
+	}
+
+	// Create the distribution model
+	return Logistic (location, scale);
+}
+
+//============================================================================//
+//      Normal distribution                                                   //
+//============================================================================//
+template <>
+inline Normal Likelihood::WeightedFit <Normal> (
+	const double values[],					// Sorted values
+	const double weights[],					// Weights of the values
+	size_t size								// Count of the values
+){
+	double mean, variance;
+	WeightedMoments (values, weights, size, mean, variance);
+	const double scale = sqrt (variance);
+	if (!(scale > 0.0))
+		throw invalid_argument ("Normal likelihood: Can not estimate the scale value for the dataset");
+	return Normal (mean, scale);
+}
+
+//============================================================================//
+//      Laplace distribution                                                  //
+//============================================================================//
+template <>
+inline Laplace Likelihood::WeightedFit <Laplace> (
+	const double values[],					// Sorted values
+	const double weights[],					// Weights of the values
+	size_t size								// Count of the values
+){
+	// The location is the weighted median of the sorted values
+	double total = 0.0;
+	for (size_t i = 0; i < size; i++)
+		total += weights [i];
+	double location = NAN;
+	double sum = 0.0;
+	for (size_t i = 0; i < size; i++) {
+		sum += weights [i];
+		if (sum >= 0.5 * total) {
+			location = values [i];
+			break;
+		}
+	}
+
+	// The scale is the weighted mean absolute deviation from the median
+	double sum_abs_dev = 0.0;
+	for (size_t i = 0; i < size; i++)
+		sum_abs_dev += weights [i] * fabs (values [i] - location);
+	const double scale = sum_abs_dev / total;
+	if (!(scale > 0.0))
+		throw invalid_argument ("Laplace likelihood: Can not estimate the scale value for the dataset");
+	return Laplace (location, scale);
+}
+}
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
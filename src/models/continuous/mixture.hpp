@@ -0,0 +1,605 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                 DISTRIBUTION MODEL FOR MIXTURE DISTRIBUTIONS                 #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<thread>
+# include	<mutex>
+# include	<condition_variable>
+# include	<exception>
+# include	<random>
+# include	<algorithm>
+# include	"../../templates/vmath.hpp"
+# include	"continuous.hpp"
+# include	"likelihood.hpp"
+
+// Maximal count of EM iterations
+# define	MIXTURE_ITERATIONS	1000
+
+// Relative change of the log-likelihood which stops the EM iterations
+# define	MIXTURE_EPSILON		1e-10
+
+// Count of observations every E-step pass processes at once
+# define	MIXTURE_BLOCK		4096
+
+// Minimal count of observations every thread processes
+# define	MIXTURE_CHUNK		32768
+
+// Smallest weight of a mixture component
+# define	MIXTURE_MIN_WEIGHT	1e-6
+
+//****************************************************************************//
+//      Name space "Model"                                                    //
+//****************************************************************************//
+namespace Model
+{
+//****************************************************************************//
+//      Class "Mixture"                                                       //
+//****************************************************************************//
+// INFO:	The mixture of K distributions of the same type T. The components
+//			are fitted to empirical data by the EM algorithm. The E-step splits
+//			the observations between the threads and evaluates component
+//			densities for blocks of observations through the batch PDF
+//			functions, so the models with vectorized kernels use them. The
+//			threads are started once per fit and run the iterations in lock
+//			step, and small datasets are fitted in the current thread. The
+//			M-step refits every component by its weighted maximum likelihood
+//			estimator (see "Likelihood::WeightedFit"). The weights of the
+//			observations are counts of the values, so they scale both the
+//			responsibilities and the log-likelihood
+template <size_t K, typename T = Normal>
+class Mixture final : public BaseContinuous
+{
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	const vector <T> components;	// Components of the mixture
+	const vector <double> weights;	// Weights of the components
+
+// Synchronization point of the threads which run the EM iterations
+class Barrier {
+	mutex lock;						// Lock of the counters
+	condition_variable signal;		// Signal of the finished phase
+	size_t threads;					// Count of threads to wait for
+	size_t waiting;					// Count of threads which are waiting
+	size_t phase;					// Count of finished phases
+
+public:
+	Barrier (
+		size_t threads				// Count of threads to wait for
+	) : threads (threads), waiting (0), phase (0)
+	{}
+
+	// Wait until all the threads come to the barrier
+	void Wait (void) {
+		unique_lock <mutex> guard (lock);
+		const size_t current = phase;
+		if (++waiting == threads) {
+			waiting = 0;
+			phase++;
+			signal.notify_all();
+		}
+		else
+			signal.wait (guard, [&] { return phase != current; });
+	}
+};
+
+// Extract the distribution parameters from empirical observations
+struct Params {
+
+	// Members
+	vector <T> components;			// Components of the mixture
+	vector <double> weights;		// Weights of the components
+
+	// Refit the components to the responsibilities
+	void Maximize (
+		const double values[],			// Sorted observations
+		size_t size,					// Count of the observations
+		const vector <double> &resp,	// Responsibilities of the components
+		double mass						// Sum of the weights of the observations
+	){
+		// Weights and components for the responsibilities
+		vector <T> next;
+		next.reserve (K);
+		weights.assign (K, 0.0);
+		for (size_t k = 0; k < K; k++) {
+			const double *temp = resp.data() + k * size;
+			for (size_t i = 0; i < size; i++)
+				weights [k] += temp [i];
+			weights [k] /= mass;
+			if (!(weights [k] >= MIXTURE_MIN_WEIGHT))
+				throw invalid_argument ("Mixture params: A component of the mixture has vanished");
+			next.push_back (Likelihood::WeightedFit <T> (values, temp, size));
+		}
+		components = move (next);
+	}
+
+	// Find the responsibilities for the observations in the range
+	void Expect (
+		const double values[],			// Sorted observations
+		size_t size,					// Count of the observations
+		const double priors[],			// Weights of the observations (or NULL)
+		vector <double> &resp,			// Responsibilities of the components
+		size_t begin,					// The first observation of the range
+		size_t end,						// The end of the range
+		double &loglik					// Log-likelihood of the range
+	) const {
+		vector <double> block, total, temp;
+		loglik = 0.0;
+		for (size_t i = begin; i < end; i += MIXTURE_BLOCK) {
+
+			// Weighted densities of the components for the block
+			const size_t count = min (end - i, size_t (MIXTURE_BLOCK));
+			block.assign (values + i, values + i + count);
+			total.assign (count, 0.0);
+			for (size_t k = 0; k < K; k++) {
+				const vector <double> pdf = components [k].PDFs (block);
+				double *target = resp.data() + k * size + i;
+				for (size_t j = 0; j < count; j++) {
+					target [j] = weights [k] * pdf [j];
+					total [j] += target [j];
+				}
+			}
+
+			// Accumulate the log-likelihood of the block. The observations
+			// where all the densities underflow keep the prior weights
+			temp.resize (count);
+			VMath::Log (temp.data(), total.data(), count);
+			for (size_t j = 0; j < count; j++)
+				if (total [j] > 0.0) loglik += (priors ? priors [i + j] : 1.0) * temp [j];
+
+			// Normalize the responsibilities and weigh them by the observations
+			for (size_t j = 0; j < count; j++)
+				temp [j] = total [j] > 0.0 ? 1.0 / total [j] : 0.0;
+			for (size_t k = 0; k < K; k++) {
+				double *target = resp.data() + k * size + i;
+				for (size_t j = 0; j < count; j++) {
+					const double prior = priors ? priors [i + j] : 1.0;
+					target [j] = prior * (temp [j] > 0.0 ? target [j] * temp [j] : weights [k]);
+				}
+			}
+		}
+	}
+
+	// Constructor
+	Params (
+		const Observations &data	// Empirical observations
+	){
+		// Check if empirical data range is inside the model domain
+		if (!T::InDomain (data.Domain()))
+			throw invalid_argument ("Mixture params: The data range is outside the distribution domain");
+
+		// Check if every component can get enough observations
+		const double *values = data.RankedData();
+		const double *priors = data.RankedWeights();
+		const double mass = data.TotalWeight();
+		const size_t size = data.Size();
+		if (size < 2 * K)
+			throw invalid_argument ("Mixture params: Too few observations for the count of components");
+
+		// The initial components are fitted to the equal slices of the sorted data
+		vector <double> resp (K * size, 0.0);
+		for (size_t k = 0; k < K; k++)
+			for (size_t i = k * size / K; i < (k + 1) * size / K; i++)
+				resp [k * size + i] = priors ? priors [i] : 1.0;
+		Maximize (values, size, resp, mass);
+
+		// Split the observations between the threads
+		const size_t blocks = (size + MIXTURE_BLOCK - 1) / MIXTURE_BLOCK;
+		const size_t chunks = (size + MIXTURE_CHUNK - 1) / MIXTURE_CHUNK;
+		const size_t threads = min (size_t (max (thread::hardware_concurrency(), 1u)), chunks);
+		vector <size_t> bounds (threads + 1);
+		for (size_t t = 0; t <= threads; t++)
+			bounds [t] = t * blocks / threads * MIXTURE_BLOCK;
+		bounds [threads] = size;
+
+		// Every thread runs the EM iterations for its part of the observations.
+		// The first thread checks the convergence and does the M-step, while
+		// the others wait for it at the barrier. A thread which fails keeps
+		// its exception and still meets the barriers, so the first thread
+		// stops all of them at the end of the iteration
+		vector <double> partial (threads, 0.0);
+		vector <exception_ptr> failures (threads);
+		double value = -INFINITY;
+		bool stop = false;
+		exception_ptr error;
+		Barrier barrier (threads);
+		auto iterate = [&] (size_t t) {
+			for (size_t n = 0; n < MIXTURE_ITERATIONS && !stop; n++) {
+
+				// E-step for the part of the observations
+				try {
+					Expect (values, size, priors, resp, bounds [t], bounds [t + 1], partial [t]);
+				}
+				catch (...) {
+					failures [t] = current_exception();
+				}
+				barrier.Wait();
+
+				// Check for the convergence and do the M-step
+				if (t == 0) {
+					for (const auto &failure : failures)
+						if (failure && !error) error = failure;
+					bool done = false;
+					if (!error)
+					try {
+						double loglik = 0.0;
+						for (const auto temp : partial)
+							loglik += temp;
+						done = fabs (loglik - value) <= MIXTURE_EPSILON * fabs (loglik);
+						value = loglik;
+						Maximize (values, size, resp, mass);
+					}
+					catch (...) {
+						error = current_exception();
+					}
+					stop = done || error;
+				}
+				barrier.Wait();
+			}
+		};
+
+		// Start the threads once and wait for them
+		vector <thread> pool;
+		for (size_t t = 1; t < threads; t++)
+			pool.push_back (thread (iterate, t));
+		iterate (0);
+		for (auto &worker : pool)
+			worker.join();
+		if (error)
+			rethrow_exception (error);
+	}
+};
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+	Mixture (
+		const Params &params		// Distribution parameters
+	) : Mixture (params.components, params.weights)
+	{}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructor                                                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	Mixture (
+		const vector <T> &components,	// Components of the mixture
+		const vector <double> &weights	// Weights of the components
+	) :	components (components),
+		weights (weights)
+	{
+		// Check if the count of the components is correct
+		if (components.size() != K || weights.size() != K)
+			throw invalid_argument ("Mixture: The count of components and weights must be equal to the mixture size");
+
+		// Check if the weights are correct
+		double total = 0.0;
+		for (const auto weight : weights) {
+			if (!(weight > 0.0))
+				throw invalid_argument ("Mixture: The component weights must be positive");
+			total += weight;
+		}
+		if (fabs (total - 1.0) > 1e-9)
+			throw invalid_argument ("Mixture: The component weights must sum to 1");
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructor for empirical data                                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	Mixture (
+		const Observations &data	// Empirical observations
+	) : Mixture (Params (data))
+	{}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Check if the range is inside the model domain                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static bool InDomain (
+		const Range &subrange		// Testing range
+	){
+		return T::InDomain (subrange);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Component of the mixture                                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const T& Component (
+		size_t index				// Index of the component
+	) const {
+		if (index < K)
+			return components [index];
+		else
+			throw invalid_argument ("Component: The index is out of the mixture size");
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Weight of the component                                               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double Weight (
+		size_t index				// Index of the component
+	) const {
+		if (index < K)
+			return weights [index];
+		else
+			throw invalid_argument ("Weight: The index is out of the mixture size");
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Function domain where the distribution exists                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual const Range& Domain (void) const override final {
+		return components [0].Domain();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Number of distribution parameters to describe the population          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual size_t Parameters (void) const override final {
+		return K * components [0].Parameters() + K - 1;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Fill the buffer with random values from the distribution              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	Every component generates its share of the values by its own
+//			generator, then the values are shuffled
+	virtual void Fill (
+		double *data,				// Buffer to fill
+		size_t count,				// Count of values to generate
+		mt19937 &generator			// Random number engine
+	) const override final {
+
+		// Count of values for every component
+		vector <size_t> counts (K, 0);
+		discrete_distribution <size_t> choice (weights.begin(), weights.end());
+		for (size_t i = 0; i < count; i++)
+			counts [choice (generator)]++;
+
+		// Generate the values of the components
+		double *target = data;
+		for (size_t k = 0; k < K; k++) {
+			components [k].Fill (target, counts [k], generator);
+			target += counts [k];
+		}
+		shuffle (data, data + count, generator);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Probability Density Function (PDF)                                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double PDF (
+		double x					// Argument value
+	) const override final {
+		double result = 0.0;
+		for (size_t k = 0; k < K; k++)
+			result += weights [k] * components [k].PDF (x);
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Cumulative Distribution Function (CDF)                                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double CDF (
+		double x					// Argument value
+	) const override final {
+		double result = 0.0;
+		for (size_t k = 0; k < K; k++)
+			result += weights [k] * components [k].CDF (x);
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Probability Density Function (PDF) for the argument values            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual vector <double> PDFs (
+		const vector <double> &values	// Argument values
+	) const override final {
+		vector <double> result (values.size(), 0.0);
+		for (size_t k = 0; k < K; k++) {
+			const vector <double> temp = components [k].PDFs (values);
+			for (size_t i = 0; i < result.size(); i++)
+				result [i] += weights [k] * temp [i];
+		}
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Cumulative Distribution Function (CDF) for the argument values        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual vector <double> CDFs (
+		const vector <double> &values	// Argument values
+	) const override final {
+		vector <double> result (values.size(), 0.0);
+		for (size_t k = 0; k < K; k++) {
+			const vector <double> temp = components [k].CDFs (values);
+			for (size_t i = 0; i < result.size(); i++)
+				result [i] += weights [k] * temp [i];
+		}
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Mode of the distribution                                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The mode of the component which has the highest mixture density
+//			there. The true mode shifts from it when the components overlap
+	virtual double Mode (void) const override final {
+		double mode = NAN;
+		double value = -INFINITY;
+		for (size_t k = 0; k < K; k++) {
+			const double x = components [k].Mode();
+			const double temp = PDF (x);
+			if (temp > value) {
+				value = temp;
+				mode = x;
+			}
+		}
+		return mode;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Raw moments of the distribution                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The raw moments of the mixture are the weighted sums of the raw
+//			moments of the components, which are found from their mean,
+//			variance, skewness and kurtosis
+	void RawMoments (
+		double moments[4]			// Raw moments from the 1st to the 4th
+	) const {
+		for (size_t i = 0; i < 4; i++)
+			moments [i] = 0.0;
+		for (size_t k = 0; k < K; k++) {
+			const T &dist = components [k];
+			const double m = dist.Mean();
+			const double v = dist.Variance();
+			const double s = dist.Skewness() * v * sqrt (v);
+			const double q = dist.Kurtosis() * v * v;
+			moments [0] += weights [k] * m;
+			moments [1] += weights [k] * (v + m * m);
+			moments [2] += weights [k] * (s + 3.0 * m * v + m * m * m);
+			moments [3] += weights [k] * (q + 4.0 * m * s + 6.0 * m * m * v + m * m * m * m);
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Mean of the distribution                                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double Mean (void) const override final {
+		double result = 0.0;
+		for (size_t k = 0; k < K; k++)
+			result += weights [k] * components [k].Mean();
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Variance of the distribution                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double Variance (void) const override final {
+		const double mean = Mean();
+		double result = 0.0;
+		for (size_t k = 0; k < K; k++) {
+			const double dev = components [k].Mean() - mean;
+			result += weights [k] * (components [k].Variance() + dev * dev);
+		}
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Skewness of the distribution                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double Skewness (void) const override final {
+		double m[4];
+		RawMoments (m);
+		const double v = Variance();
+		const double s = m[2] - 3.0 * m[0] * m[1] + 2.0 * m[0] * m[0] * m[0];
+		return s / (v * sqrt (v));
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Kurtosis of the distribution                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double Kurtosis (void) const override final {
+		double m[4];
+		RawMoments (m);
+		const double v = Variance();
+		const double mean = m[0];
+		const double q = m[3] - 4.0 * mean * m[2] + 6.0 * mean * mean * m[1] - 3.0 * mean * mean * mean * mean;
+		return q / (v * v);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Summary of the object                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual ObjectSummary Summary (void) const {
+
+		// Create the summary storage
+		const BaseModel &base = static_cast <const BaseModel&> (*this);
+		ObjectSummary summary = base.Summary ("Mixture distribution");
+
+		// Continuous distribution info
+		const BaseContinuous &continuous = static_cast <const BaseContinuous&> (*this);
+		PropGroup info = continuous.Info();
+
+		// Additional info
+		info.Append ("Components count", K);
+		for (size_t k = 0; k < K; k++) {
+			const string name = "Component " + to_string (k + 1);
+			info.Append (name + " weight", weights [k]);
+			info.Append (name + " mean", components [k].Mean());
+			info.Append (name + " std dev", components [k].StdDev());
+		}
+		summary.Prepend (info);
+
+		// Return the summary
+		return summary;
+	}
+};
+
+//****************************************************************************//
+//      Mixtures of two components for bimodal data                           //
+//****************************************************************************//
+typedef Mixture <2, Normal> NormalMixture;
+typedef Mixture <2, Gamma> GammaMixture;
+typedef Mixture <2, Laplace> LaplaceMixture;
+typedef Mixture <2, Logistic> LogisticMixture;
+
+//****************************************************************************//
+//      Maximum likelihood estimators of the mixtures                         //
+//****************************************************************************//
+// NOTE:	The EM algorithm maximizes the likelihood, so the default estimator
+//			of the mixtures is the likelihood one
+template <>
+inline NormalMixture Likelihood::Fit <NormalMixture> (
+	const Observations &data				// Empirical observations
+){
+	return NormalMixture (data);
+}
+
+template <>
+inline GammaMixture Likelihood::Fit <GammaMixture> (
+	const Observations &data				// Empirical observations
+){
+	return GammaMixture (data);
+}
+
+template <>
+inline LaplaceMixture Likelihood::Fit <LaplaceMixture> (
+	const Observations &data				// Empirical observations
+){
+	return LaplaceMixture (data);
+}
+
+template <>
+inline LogisticMixture Likelihood::Fit <LogisticMixture> (
+	const Observations &data				// Empirical observations
+){
+	return LogisticMixture (data);
+}
+
+//****************************************************************************//
+//      Translate the object to a string                                      //
+//****************************************************************************//
+template <size_t K, typename T>
+ostream& operator << (ostream &stream, const Mixture <K, T> &object)
+{
+	stream << object.Summary();
+	return stream;
+}
+}
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
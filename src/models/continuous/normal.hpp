@@ -9,11 +9,15 @@
 */
 # pragma	once
 # include	<boost/math/special_functions/erf.hpp>
+# include	"../../templates/vmath.hpp"
 # include	"../confidence_interval.hpp"
 # include	"continuous_distribution.hpp"
 # include	"chi_squared.hpp"
 # include	"standard_t.hpp"
 
+// Inverse error function of 1/2, which relates the MAD to the scale
+# define	NORMAL_ERF_INV_HALF	0.47693627620446987338
+
 //****************************************************************************//
 //      Name space "Model"                                                    //
 //****************************************************************************//
@@ -50,7 +54,7 @@ struct Params {
 
 			// Find the location and the scale for these parameters
 			location = median;
-			scale = deviation / (M_SQRT2 * boost::math::erf_inv (0.5));
+			scale = deviation / (M_SQRT2 * NORMAL_ERF_INV_HALF);
 		}
 		else
 			throw invalid_argument ("Normal params: The data range is outside the distribution domain");
@@ -156,6 +160,89 @@ public:
 		return 0.5 * (1.0 + erf (arg / M_SQRT2));
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Quantile value for the target level                                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double Quantile (
+		double level				// Quantile level to estimate
+	) const override final {
+
+		// Check if the level is correct
+		if (0.0 <= level and level <= 1.0) {
+
+			// Analytic inverse of the CDF function
+			if (level == 0.0) return -INFINITY;
+			if (level == 1.0) return +INFINITY;
+			return location + scale * M_SQRT2 * boost::math::erf_inv (2.0 * level - 1.0);
+		}
+		else
+			throw invalid_argument ("Quantile: Level must be in the range [0..1]");
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Probability Density Function (PDF) for the argument values            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual vector <double> PDFs (
+		const vector <double> &values	// Argument values
+	) const override final {
+		const double loc = location;
+		const double factor = 1.0 / scale;
+		const double norm = factor / (M_SQRT2 * sqrt (M_PI));
+		auto function = [loc, factor, norm] (VMath::vdbl x) {
+			const VMath::vdbl arg = (x - loc) * factor;
+			return norm * VMath::vexp (-0.5 * arg * arg);
+		};
+		vector <double> result (values.size());
+		VMath::apply (result.data(), values.data(), values.size(), function, loc);
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Cumulative Distribution Function (CDF) for the argument values        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The CDF is erfc (-z / sqrt (2)) / 2, so the lower tail keeps the
+//			relative precision instead of the cancellation in 1 + erf (z)
+	virtual vector <double> CDFs (
+		const vector <double> &values	// Argument values
+	) const override final {
+		const double loc = location;
+		const double factor = 1.0 / (scale * M_SQRT2);
+		auto function = [loc, factor] (VMath::vdbl x) {
+			return 0.5 * VMath::verfc ((loc - x) * factor);
+		};
+		vector <double> result (values.size());
+		VMath::apply (result.data(), values.data(), values.size(), function, loc);
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Quantile values for the target levels                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The root of erfc (x) = 2 * min (p, 1 - p) is found for the level p,
+//			so both tails are precise down to the smallest levels
+	virtual vector <double> Quantiles (
+		const vector <double> &levels	// Target levels
+	) const override final {
+
+		// Check if the levels are correct
+		for (const auto level : levels)
+			if (!(0.0 <= level and level <= 1.0))
+				throw invalid_argument ("Quantiles: Levels must be in the range [0..1]");
+
+		// Analytic inverse of the CDF function
+		const double loc = location;
+		const double factor = scale * M_SQRT2;
+		auto function = [loc, factor] (VMath::vdbl p) {
+			const VMath::vdbl q = 1.0 - p;
+			const auto lower = p < q;
+			const VMath::vdbl root = VMath::erfc_root (2.0 * (lower ? p : q));
+			return loc + factor * (lower ? -root : root);
+		};
+		vector <double> result (levels.size());
+		VMath::apply (result.data(), levels.data(), levels.size(), function, 0.5);
+		return result;
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Mean of the distribution                                              //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -74,9 +74,6 @@ public:
 		// Check if the probability value is correct
 		if (probability < 0.0 || probability > 1.0)
 			throw invalid_argument ("Bernoulli: The probability of a successful trial must be in the range [0..1]");
-
-		// Init the CDF cache
-		Init ();
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -128,7 +125,7 @@ public:
 		if (x != range) return 0.0;
 
 		// Common case
-		return 1.0 - probability;
+		return floor (x) ? probability : 1.0 - probability;
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
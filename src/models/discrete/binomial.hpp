@@ -70,6 +70,29 @@ private:
 	) : Binomial (params.trials, params.probability)
 	{}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ratio of the neighbour PMF values PDF (x + 1) / PDF (x)               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double PMFRatio (
+		double x					// Argument value
+	) const override final {
+		const double p = (trials - x) * probability;
+		const double q = (x + 1.0) * (1.0 - probability);
+		return p / q;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Remainder of the Stirling series for the factorial                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double stirling (
+		double k					// Argument value
+	){
+		const double x = k + 1.0;
+		if (x >= STIRLING_SHAPE)
+			return StirlingRemainder (x);
+		return lgamma (x) - (x - 0.5) * log (x) + x - 0.5 * log (2.0 * M_PI);
+	}
+
 //============================================================================//
 //      Public methods                                                        //
 //============================================================================//
@@ -80,8 +103,10 @@ public:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	Binomial (
 		size_t trials,				// Number of trials
-		double probability			// Probability of a successful trial
-	) :	range (0, double (trials)),
+		double probability,			// Probability of a successful trial
+		double tail = DISCRETE_TAIL	// Probability mass of a tail left outside the cached tables
+	) :	BaseDiscrete (tail),
+		range (0, double (trials)),
 		gamma_log (lgamma (trials + 1)),
 		probability (probability),
 		trials (trials)
@@ -93,9 +118,6 @@ public:
 		// Check if the probability value is correct
 		if (probability < 0.0 && probability > 1.0)
 			throw invalid_argument ("Binomial: The probability of a successful trial must be in the range [0..1]");
-
-		// Init the CDF cache
-		Init ();
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -171,6 +193,68 @@ public:
 		return beta.RegIncompleteBeta (1.0 - probability);
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Fill the buffer with random values from the distribution              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	Wide distributions are sampled by the transformed rejection with
+//			squeeze (BTRS) of Hörmann instead of the alias table. The method
+//			works for the success probability up to 0.5, so the greater ones
+//			count the failures instead
+	virtual void Fill (
+		double *data,				// Buffer to fill
+		size_t count,				// Count of values to generate
+		mt19937 &generator			// Random number engine
+	) const override final {
+
+		// Narrow distributions use the alias table
+		if (Narrow (trials * probability * (1.0 - probability)))
+			return BaseDiscrete::Fill (data, count, generator);
+
+		// Count the rarer outcome of the trials
+		const bool flip = probability > 0.5;
+		const double p = flip ? 1.0 - probability : probability;
+		const double n = trials;
+
+		// Constants of the hat function
+		const double spq = sqrt (n * p * (1.0 - p));
+		const double b = 1.15 + 2.53 * spq;
+		const double a = -0.0873 + 0.0248 * b + 0.01 * p;
+		const double c = n * p + 0.5;
+		const double vr = 0.92 - 4.2 / b;
+		const double r = p / (1.0 - p);
+		const double alpha = log ((2.83 + 5.1 / b) * spq);
+		const double m = floor ((n + 1.0) * p);
+		const double h = (m + 0.5) * log ((m + 1.0) / (r * (n - m + 1.0))) + stirling (m) + stirling (n - m);
+
+		// Generate the values by the transformed rejection
+		uniform_real_distribution <double> uniform (0.0, 1.0);
+		for (size_t i = 0; i < count; i++) {
+			double k;
+			while (true) {
+				const double u = uniform (generator) - 0.5;
+				const double v = uniform (generator);
+				const double us = 0.5 - fabs (u);
+				k = floor ((2.0 * a / us + b) * u + c);
+
+				// Reject the values outside the domain
+				if (k < 0.0 || k > n)
+					continue;
+
+				// Quick acceptance inside the squeeze
+				if (us >= 0.07 && v <= vr)
+					break;
+
+				// Exact acceptance test
+				const double temp = log (v) + alpha - log (a / (us * us) + b);
+				const double t1 = (n + 1.0) * log ((n - m + 1.0) / (n - k + 1.0));
+				const double t2 = (k + 0.5) * log (r * (n - k + 1.0) / (k + 1.0));
+				if (temp <= h + t1 + t2 - stirling (k) - stirling (n - k))
+					break;
+			}
+			data [i] = flip ? n - k : k;
+		}
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Mode of the distribution                                              //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
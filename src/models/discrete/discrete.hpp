@@ -8,11 +8,20 @@
 ################################################################################
 */
 # pragma	once
+# include	<mutex>
 # include	"../base.hpp"
 
 // Epsilon value for quartile estimation
 # define	QUARTILE_EPSILON	1e-10
 
+// Largest distribution location to sample by the alias table. Models with a
+// special generator use it for wider locations, which they estimate by the
+// variance without building the table
+# define	ALIAS_SIZE			16384
+
+// Default probability mass of a tail left outside the cached tables
+# define	DISCRETE_TAIL		1e-16
+
 //****************************************************************************//
 //      Name space "Model"                                                    //
 //****************************************************************************//
@@ -27,9 +36,15 @@ class BaseDiscrete : public BaseModel
 //      Members                                                               //
 //============================================================================//
 private:
-	vector <double> cmf;	// Cached values of the CMF function for quick calculations
-	size_t min_index;		// The minimum index where the PDF value is still different from zero
-	size_t max_index;		// The maximum index where the PDF value is still different from zero
+	const double tail;				// Probability mass of a tail left outside the cached tables
+	mutable once_flag cached;		// Flag of the built PMF and CMF tables
+	mutable once_flag aliased;		// Flag of the built alias table
+	mutable vector <double> cmf;	// Cached values of the CMF function for quick calculations
+	mutable vector <double> pmf;	// Cached values of the PMF function the CMF is summed from
+	mutable size_t min_index;		// The minimum index where the PDF value is still different from zero
+	mutable size_t max_index;		// The maximum index where the PDF value is still different from zero
+	mutable vector <double> alias_prob;		// Probabilities to keep the alias table cell
+	mutable vector <size_t> alias_index;	// Alias indices of the alias table cells
 
 //============================================================================//
 //      Private methods                                                       //
@@ -48,35 +63,155 @@ private:
 		return fabs (cmf.at (value - min_index) - level) <= QUARTILE_EPSILON ? value + 0.5 : value;
 	}
 
-//============================================================================//
-//      Protected methods                                                     //
-//============================================================================//
-protected:
-
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-//      Init the cache of the CMF values used for quantile estimates          //
+//      Init the cache of the PMF and CMF values used for quantile estimates  //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	void Init (void) {
+// INFO:	The cache is built on the first request. The PMF values are found
+//			by the walk in both directions from the mode with the recurrence
+//			PMF (k + 1) = PMF (k) * PMFRatio (k). The walk stops when the mass
+//			of the rest of the tail, bounded by a geometric series of the
+//			last ratio, drops below the tail mass. The PMF values are scaled
+//			to the unit total mass, which also removes the rounding error of
+//			the PDF value at the mode, and the CMF values are their running
+//			sums. The tables are built once, even if several threads request
+//			them at the same time
+	void Init (void) const {
 
-		// Initial position to look for significant CDF points to cache
+		// Initial position to look for significant PMF points to cache
 		double pos = Mode();
 		if (isnan (pos)) pos = Mean();
 		if (isinf (pos)) pos = Domain().Min();
+		const int64_t start = pos;
+
+		// The next PMF value in the direction of the walk
+		auto next = [this] (int64_t k, double value, int64_t dir) {
+			const int64_t arg = k + dir;
+			const double ratio = dir > 0 ? PMFRatio (k) : 1.0 / PMFRatio (arg);
+			return isnan (ratio) ? PDF (arg) : value * ratio;
+		};
+
+		// Walk to the left while the tail mass is significant
+		const double first = PDF (start);
+		vector <double> lower;
+		double value = first;
+		for (int64_t k = start; k > Domain().Min(); k--) {
+			const double temp = next (k, value, -1);
+			const double ratio = temp / value;
+			if (!(temp > 0.0) || (ratio < 1.0 && temp / (1.0 - ratio) < tail)) break;
+			lower.push_back (temp);
+			value = temp;
+		}
+
+		// Walk to the right while the tail mass is significant
+		vector <double> upper;
+		value = first;
+		for (int64_t k = start; k < Domain().Max(); k++) {
+			const double temp = next (k, value, +1);
+			const double ratio = temp / value;
+			if (!(temp > 0.0) || (ratio < 1.0 && temp / (1.0 - ratio) < tail)) break;
+			upper.push_back (temp);
+			value = temp;
+		}
+
+		// Join both walks into the PMF table
+		min_index = start - lower.size();
+		max_index = start + upper.size();
+		pmf.assign (lower.rbegin(), lower.rend());
+		pmf.push_back (first);
+		pmf.insert (pmf.end(), upper.begin(), upper.end());
+
+		// Scale the PMF values to the mass inside the location
+		double total = 0.0;
+		for (const auto value : pmf)
+			total += value;
+		double sum = CDF (min_index - 1.0);
+		const double scale = (1.0 - sum) / total;
 
-		// Find the minimum index where the PDF value is still different from zero
-		int64_t first_index = pos;
-		while (1.0 - PDF (first_index) < 1.0) --first_index;
-		min_index = first_index + 1;
+		// Sum the PMF values up with the mass below the location
+		cmf.reserve (pmf.size());
+		for (auto &value : pmf) {
+			value *= scale;
+			sum += value;
+			cmf.push_back (min (sum, 1.0));
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Build the alias table from the cached PMF values                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	Vose's method: every cell of the table holds the mean probability.
+//			An underfull cell is topped up from an overfull one, which becomes
+//			its alias. A random value then needs one cell lookup only
+	void InitAlias (void) const {
 
-		// Find the maximum index where the PDF value is still different from zero
-		int64_t last_index = pos;
-		while (1.0 - PDF (last_index) < 1.0) ++last_index;
-		max_index = last_index - 1;
+		// Scale the probabilities to the mean value of one per cell
+		const size_t size = pmf.size();
+		double total = 0.0;
+		for (const auto value : pmf)
+			total += max (value, 0.0);
+		alias_prob.resize (size);
+		alias_index.resize (size);
+		vector <size_t> small, large;
+		for (size_t i = 0; i < size; i++) {
+			alias_prob [i] = max (pmf [i], 0.0) * size / total;
+			alias_index [i] = i;
+			if (alias_prob [i] < 1.0)
+				small.push_back (i);
+			else
+				large.push_back (i);
+		}
 
-		// Fill the cache with CMF values for quick further estimates
-		for (size_t i = min_index; i <= max_index; i++) {
-			cmf.push_back (CDF (i));
+		// Top up every underfull cell from an overfull one
+		while (!small.empty() && !large.empty()) {
+			const size_t s = small.back();
+			const size_t l = large.back();
+			small.pop_back();
+			alias_index [s] = l;
+			alias_prob [l] -= 1.0 - alias_prob [s];
+			if (alias_prob [l] < 1.0) {
+				large.pop_back();
+				small.push_back (l);
+			}
 		}
+
+		// The rest of the cells are full up to the rounding errors
+		for (const auto i : small) alias_prob [i] = 1.0;
+		for (const auto i : large) alias_prob [i] = 1.0;
+	}
+
+//============================================================================//
+//      Protected methods                                                     //
+//============================================================================//
+protected:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ratio of the neighbour PMF values PDF (x + 1) / PDF (x)               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	Models without a cheap recurrence return NAN, so the cache is
+//			filled by the PDF function instead
+	virtual double PMFRatio (
+		double				// Argument value (not used)
+	) const {
+		return NAN;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Check if the distribution is narrow enough for the alias table        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The width of the location is estimated by the normal tails of the
+//			same variance, so the check does not build the cached tables
+	bool Narrow (
+		double variance		// Variance of the distribution
+	) const {
+		const double width = 2.0 * sqrt (-2.0 * log (tail) * variance);
+		return width <= ALIAS_SIZE;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Build the cached PMF and CMF tables on the first use                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Cache (void) const {
+		call_once (cached, [this] { Init(); });
 	}
 
 //============================================================================//
@@ -87,15 +222,78 @@ public:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Constructor                                                           //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	BaseDiscrete (void) : min_index (0), max_index (0) {}
+	BaseDiscrete (
+		double tail = DISCRETE_TAIL	// Probability mass of a tail left outside the cached tables
+	) :	tail (tail),
+		min_index (0),
+		max_index (0)
+	{
+		// Check if the tail mass is correct
+		if (!(0.0 < tail && tail < 1.0))
+			throw invalid_argument ("BaseDiscrete: The tail mass must be in the range (0..1)");
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Copy constructor                                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The copy builds its own tables on the first use, so it does not read
+//			the tables of the source while another thread may build them
+	BaseDiscrete (
+		const BaseDiscrete &source	// Source model
+	) :	BaseModel (source),
+		tail (source.tail),
+		min_index (0),
+		max_index (0)
+	{}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Probability mass of a tail left outside the cached tables             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double Tail (void) const {
+		return tail;
+	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Location where the PDF function is distinguishable from zero          //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual Range DistLocation (void) const override final {
+		Cache();
 		return Range (min_index, max_index);
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Cached CMF and PMF tables for the distribution location               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The first table value belongs to the minimum index of the location
+	const vector <double>& CMF (void) const {
+		Cache();
+		return cmf;
+	}
+
+	const vector <double>& PMF (void) const {
+		Cache();
+		return pmf;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      CDF value taken from the cache when it is possible                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double CachedCDF (
+		double x					// Argument value
+	) const {
+
+		// Build the cache on the first use
+		Cache();
+
+		// Arguments inside the location are read from the CMF table
+		const double index = floor (x) - min_index;
+		if (0.0 <= index and index < cmf.size())
+			return cmf [size_t (index)];
+
+		// Other arguments are computed by the model
+		return CDF (x);
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Quantile value for the target level                                   //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -106,12 +304,15 @@ public:
 		// Check if the level is correct
 		if (0.0 <= level and level <= 1.0) {
 
+			// Build the cache on the first use
+			Cache();
+
 			// Binary search of argument value for the CMF function
 			int64_t left = 0;
 			int64_t right = cmf.size();
 			while (left < right) {
 				const size_t median = (left + right) / 2;
-				if (cmf.at (median) < level)
+				if (cmf [median] < level)
 					left = median + 1;
 				else
 					right = median;
@@ -123,6 +324,33 @@ public:
 		else throw invalid_argument ("Quantile: Level must be in the range [0..1]");
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Fill the buffer with random values from the distribution              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The alias table is built on the first call. The integer part of
+//			a uniform value selects the table cell, the fractional part
+//			chooses between the cell and its alias
+	virtual void Fill (
+		double *data,			// Buffer to fill
+		size_t count,			// Count of values to generate
+		mt19937 &generator		// Random number engine
+	) const override {
+
+		// Build the caches on the first use
+		Cache();
+		call_once (aliased, [this] { InitAlias(); });
+
+		// Draw the values from the alias table
+		const size_t size = alias_prob.size();
+		uniform_real_distribution <double> uniform (0.0, size);
+		for (size_t i = 0; i < count; i++) {
+			const double rnd = uniform (generator);
+			const size_t cell = min (size_t (rnd), size - 1);
+			const bool flag = rnd - cell < alias_prob [cell];
+			data [i] = min_index + (flag ? cell : alias_index [cell]);
+		}
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Ceil quantile value for the target level                              //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -155,6 +383,7 @@ public:
 		// Trivial info
 		PropGroup info ("Discrete distribution");
 		info.Append ("Parameters count", Parameters());
+		info.Append ("Tail mass outside the tables", tail);
 
 		// Return the info
 		return info;
@@ -59,6 +59,15 @@ private:
 	) : Geometric (params.probability)
 	{}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ratio of the neighbour PMF values PDF (x + 1) / PDF (x)               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double PMFRatio (
+		double						// Argument value (not used)
+	) const override final {
+		return 1.0 - probability;
+	}
+
 //============================================================================//
 //      Public methods                                                        //
 //============================================================================//
@@ -68,15 +77,14 @@ public:
 //      Constructor                                                           //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	Geometric (
-		double probability			// Probability of a successful trial
-	) :	probability (probability)
+		double probability,			// Probability of a successful trial
+		double tail = DISCRETE_TAIL	// Probability mass of a tail left outside the cached tables
+	) :	BaseDiscrete (tail),
+		probability (probability)
 	{
 		// Check if the probability value is correct
 		if (probability < 0.0 || probability > 1.0)
 			throw invalid_argument ("Geometric: The probability of a successful trial must be in the range [0..1]");
-
-		// Init the CDF cache
-		Init ();
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
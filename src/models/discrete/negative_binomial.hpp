@@ -68,6 +68,17 @@ private:
 	) : NegativeBinomial (params.successes, params.probability)
 	{}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ratio of the neighbour PMF values PDF (x + 1) / PDF (x)               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double PMFRatio (
+		double x					// Argument value
+	) const override final {
+		const double p = (x + successes) * (1.0 - probability);
+		const double q = x + 1.0;
+		return p / q;
+	}
+
 //============================================================================//
 //      Public methods                                                        //
 //============================================================================//
@@ -78,8 +89,10 @@ public:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	NegativeBinomial (
 		size_t successes,			// Number of successes
-		double probability			// Success probability
-	) :	gamma_log (lgamma (successes)),
+		double probability,			// Success probability
+		double tail = DISCRETE_TAIL	// Probability mass of a tail left outside the cached tables
+	) :	BaseDiscrete (tail),
+		gamma_log (lgamma (successes)),
 		probability (probability),
 		successes (successes)
 	{
@@ -90,9 +103,6 @@ public:
 		// Check if the probability value is correct
 		if (probability < 0.0 && probability > 1.0)
 			throw invalid_argument ("NegativeBinomial: The success probability must be in the range [0..1]");
-
-		// Init the CDF cache
-		Init ();
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -60,6 +60,15 @@ private:
 	) : Poisson (params.rate)
 	{}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ratio of the neighbour PMF values PDF (x + 1) / PDF (x)               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual double PMFRatio (
+		double x					// Argument value
+	) const override final {
+		return rate / (x + 1.0);
+	}
+
 //============================================================================//
 //      Public methods                                                        //
 //============================================================================//
@@ -69,15 +78,14 @@ public:
 //      Constructor                                                           //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	Poisson (
-		double rate					// Expected rate of occurrences
-	) :	rate (rate)
+		double rate,				// Expected rate of occurrences
+		double tail = DISCRETE_TAIL	// Probability mass of a tail left outside the cached tables
+	) :	BaseDiscrete (tail),
+		rate (rate)
 	{
 		// Check if the expected rate of occurrences is correct
 		if (rate <= 0.0)
 			throw invalid_argument ("Poisson: The rate value must be positive");
-
-		// Init the CDF cache
-		Init ();
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -149,6 +157,56 @@ public:
 		return NormalizedUpperIncompleteGamma (rate, arg + 1);
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Fill the buffer with random values from the distribution              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	Wide distributions are sampled by the transformed rejection with
+//			squeeze (PTRS) of Hörmann instead of the alias table. It costs a
+//			couple of uniform values per random value and needs no tables
+	virtual void Fill (
+		double *data,				// Buffer to fill
+		size_t count,				// Count of values to generate
+		mt19937 &generator			// Random number engine
+	) const override final {
+
+		// Narrow distributions use the alias table
+		if (Narrow (rate))
+			return BaseDiscrete::Fill (data, count, generator);
+
+		// Constants of the hat function
+		const double loglam = log (rate);
+		const double b = 0.931 + 2.53 * sqrt (rate);
+		const double a = -0.059 + 0.02483 * b;
+		const double alpha = log (1.1239 + 1.1328 / (b - 3.4));
+		const double vr = 0.9277 - 3.6224 / (b - 2.0);
+
+		// Generate the values by the transformed rejection
+		uniform_real_distribution <double> uniform (0.0, 1.0);
+		for (size_t i = 0; i < count; i++) {
+			double k;
+			while (true) {
+				const double u = uniform (generator) - 0.5;
+				const double v = uniform (generator);
+				const double us = 0.5 - fabs (u);
+				k = floor ((2.0 * a / us + b) * u + rate + 0.43);
+
+				// Quick acceptance inside the squeeze
+				if (us >= 0.07 && v <= vr)
+					break;
+
+				// Reject the values outside the domain and the hat tails
+				if (k < 0.0 || (us < 0.013 && v > us))
+					continue;
+
+				// Exact acceptance test
+				const double temp = log (v) + alpha - log (a / (us * us) + b);
+				if (temp <= k * loglam - rate - lgamma (k + 1.0))
+					break;
+			}
+			data [i] = k;
+		}
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Mode of the distribution                                              //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
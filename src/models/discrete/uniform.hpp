@@ -39,10 +39,7 @@ public:
 		int64_t min,				// Min value of the range
 		int64_t max					// Max value of the range
 	) :	range (min, max)
-	{
-		// Init the CDF cache
-		Init ();
-	}
+	{}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Constructor for empirical data                                        //
@@ -9,10 +9,33 @@
 */
 # pragma	once
 # include	<cmath>
+# include	<vector>
+# include	<algorithm>
 # include	<stdexcept>
+# include	<boost/math/special_functions/log1p.hpp>
+# include	"../../templates/array.hpp"
+# include	"gamma.hpp"
 
-// Number of iterations to calculate the continued fraction
-# define	BETA_N		52
+// Maximal count of iterations to calculate the continued fraction
+# define	BETA_ITERATIONS		10000
+
+// Relative precision of the continued fraction
+# define	BETA_EPSILON		1e-16
+
+// The smallest value the Lentz algorithm keeps its denominators from
+# define	BETA_TINY			1e-300
+
+// The smallest A and B arguments the Temme uniform asymptotic expansion is
+// used for
+# define	BETA_TEMME_SHAPE	1e7
+
+// Maximal scaled deviation of the argument from the mean for the Temme uniform
+// asymptotic expansion
+# define	BETA_TEMME_RANGE	3.0
+
+// Deviation of the argument from the mean the Temme expansion coefficient is
+// taken from its Taylor series below
+# define	BETA_TEMME_ETA		1e-5
 
 //****************************************************************************//
 //      Name space "Model"                                                    //
@@ -37,52 +60,206 @@ private:
 //============================================================================//
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-//      The helper function to calculate the trimmed continued fraction       //
+//      Logarithm of the beta function                                        //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	// Arguments are always correct because of preceding checks in the caller class
-	static double continued_fraction (
-		double x,			// Argument value
-		double a,			// A argument of the incomplete beta function
-		double b			// B argument of the incomplete beta function
+	// NOTE:	When the larger argument is big, the difference of its gamma
+	//			function logarithms is taken from the Stirling series, so small
+	//			second arguments do not cancel out
+	static double beta_logarithm (
+		double a,			// A argument of the beta function
+		double b			// B argument of the beta function
 	){
-		double res = 0.0;
-		for (size_t i = BETA_N; i > 0; i--) {
-			const double temp1 = a + 2.0 * i;
-			const double temp2 = temp1 - 1.0;
-			const double temp3 = temp1 + 1.0;
-			const double temp4 = a + i;
-			const double temp5 = b - i;
-			const double temp6 = x / temp2;
-
-			// Intermediate P and Q for the loop
-			const double p = (temp4 - 1.0) * (temp4 + b - 1.0) * temp5 * i * temp6 * temp6;
-			const double q = temp1 + (i * temp5 / temp2 - temp4 * (temp4 + b) / temp3) * x;
-
-			// Update the intermediate result
-			res = p / (q + res);
-		}
+		const double big = max (a, b);
+		const double small = min (a, b);
+		if (big < STIRLING_SHAPE)
+			return lgamma (a) + lgamma (b) - lgamma (a + b);
+		const double sum = big + small;
+		const double temp1 = small - (big - 0.5) * boost::math::log1p (small / big) - small * log (sum);
+		const double temp2 = StirlingRemainder (big) - StirlingRemainder (sum);
+		return lgamma (small) + temp1 + temp2;
+	}
 
-		// Finalize the calculation of the continued fraction
-		const double p = 1.0;
-		const double q = a * (1.0 - (a + b) / (a + 1.0) * x) + res;
-		return p / q;
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Keep the Lentz denominators away from zero                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double guard (
+		double value		// Denominator value
+	){
+		return fabs (value) < BETA_TINY ? BETA_TINY : value;
+	}
+	static Array::vdbl guard (
+		Array::vdbl value	// Denominator values
+	){
+		const Array::vdbl tiny = value - value + BETA_TINY;
+		return (value < tiny) & (value > -tiny) ? tiny : value;
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-//      Incomplete beta function                                              //
+//      Check if the Lentz correction does not change the convergent          //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	static double incomplete (
-		double x,			// Argument value
-		double a,			// A argument of the incomplete beta function
-		double b,			// B argument of the incomplete beta function
-		double denominator	// The denominator value for the incomplete beta function
+	static bool converged (
+		double delta		// Correction factor of the convergent
+	){
+		return fabs (delta - 1.0) < BETA_EPSILON;
+	}
+	static bool converged (
+		Array::vdbl delta	// Correction factors of the convergents
 	){
-		const double temp = a * log (x) + b * log (1.0 - x);
-		const double scale = exp (temp - denominator);
-		if (x <= a / (a + b))
-			return continued_fraction (x, a, b) * scale;
+		for (size_t i = 0; i < sizeof (Array::vdbl) / sizeof (double); i++)
+			if (!converged (delta [i])) return false;
+		return true;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Continued fraction of the incomplete beta function                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// NOTE:	This is the contracted fraction of DiDonato and Morris. It takes
+	//			the complement 1 - x as a separate argument, so the terms do not
+	//			cancel out for x near 1. The fraction is evaluated forward by
+	//			the modified Lentz algorithm and stops as soon as the convergents
+	//			are stable. It converges fast when the argument is less than
+	//			(a + 1) / (a + b + 2). Vector arguments evaluate several
+	//			fractions at once until all of them are stable. If the fraction
+	//			does not converge, then NAN is returned
+	template <typename T>
+	static T continued_fraction (
+		T x,				// Argument value
+		T y,				// Complement of the argument value
+		T a,				// A argument of the incomplete beta function
+		T b					// B argument of the incomplete beta function
+	){
+		// Initial values of the Lentz algorithm
+		const T temp = a * y - b * x + 1.0;
+		T h = guard (a * temp / (a + 1.0));
+		T c = h;
+		T d = x - x;
+
+		// Evaluate the continued fraction until the convergents are stable
+		for (size_t i = 1; i < BETA_ITERATIONS; i++) {
+			const T m = x - x + double (i);
+			const T a2m = a + 2.0 * m;
+
+			// Next partial numerator and denominator
+			const T p = (a + m - 1.0) * (a + b + m - 1.0) * m * (b - m) * x * x / ((a2m - 1.0) * (a2m - 1.0));
+			const T q = m + m * (b - m) * x / (a2m - 1.0) + (a + m) * (temp + m * (2.0 - x)) / (a2m + 1.0);
+
+			// Update the convergent
+			d = 1.0 / guard (q + p * d);
+			c = guard (q + p / c);
+			const T delta = c * d;
+			h *= delta;
+			if (converged (delta)) return h;
+		}
+		return h * NAN;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Common prefactor of the incomplete beta function                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// NOTE:	The prefactor is x^a * (1 - x)^b / Beta (a, b). For large a and b
+	//			its logarithm is a difference of huge values, so it is expanded
+	//			around the mean a / (a + b) by the Stirling series instead
+	double prefactor (
+		double x			// Argument value
+	) const {
+
+		// Small arguments of the beta function
+		const double a = beta_a;
+		const double b = beta_b;
+		if (a < STIRLING_SHAPE || b < STIRLING_SHAPE)
+			return exp (a * log (x) + b * boost::math::log1p (-x) - beta_log);
+
+		// Large arguments of the beta function. Both relative deviations are
+		// taken from their own means, so the reflected mean keeps precision
+		const double temp1 = a * boost::math::log1pmx (x * (a + b) / a - 1.0);
+		const double temp2 = b * boost::math::log1pmx ((1.0 - x) * (a + b) / b - 1.0);
+		const double temp3 = StirlingRemainder (a + b) - StirlingRemainder (a) - StirlingRemainder (b);
+		return exp (temp1 + temp2 + temp3) * sqrt (a * b / (2.0 * M_PI * (a + b)));
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Temme uniform asymptotic expansion                                    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// NOTE:	For large a and b the continued fraction needs about
+	//			sqrt (a * b / (a + b)) iterations near the mean, so there the
+	//			function is taken from the leading terms of the Temme expansion
+	//			erfc (-eta * sqrt (s / 2)) / 2 + exp (-s * eta^2 / 2) * c0 /
+	//			sqrt (2 * pi * s), where s = a + b. Out of the expansion range
+	//			NAN is returned
+	double asymptotic (
+		double x			// Argument value
+	) const {
+
+		// Check if the expansion is accurate for the arguments
+		const double a = beta_a;
+		const double b = beta_b;
+		if (a < BETA_TEMME_SHAPE || b < BETA_TEMME_SHAPE)
+			return NAN;
+
+		// Deviation eta of the argument from the mean. The deviation t is
+		// taken from the smaller mean, so it keeps the precision
+		const double s = a + b;
+		const double p = a / s;
+		const double q = b / s;
+		const double t = p < q ? x - p : q - (1.0 - x);
+		const double temp1 = p * boost::math::log1pmx (t / p);
+		const double temp2 = q * boost::math::log1pmx (-t / q);
+		const double eta = copysign (sqrt (max (-2.0 * (temp1 + temp2), 0.0)), t);
+		if (fabs (eta) * sqrt (s) > BETA_TEMME_RANGE)
+			return NAN;
+
+		// The first coefficient of the expansion
+		double c0;
+		if (fabs (eta) < BETA_TEMME_ETA)
+			c0 = (q - p) / (3.0 * sqrt (p * q)) - (1.0 - p * q) / (12.0 * p * q) * eta;
 		else
-			return 1.0 - continued_fraction (1.0 - x, b, a) * scale;
+			c0 = 1.0 / eta - sqrt (p * q) / t;
+
+		// Sum the leading terms of the expansion
+		const double temp3 = erfc (-eta * sqrt (0.5 * s)) / 2.0;
+		return temp3 + exp (-0.5 * s * eta * eta) * c0 / sqrt (2.0 * M_PI * s);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Check if the fraction is evaluated for the reflected argument         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool reflected (
+		double x			// Argument value
+	) const {
+		return x > (beta_a + 1.0) / (beta_a + beta_b + 2.0);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Regularized incomplete beta function for the inner arguments          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double incomplete (
+		double x			// Argument value
+	) const {
+		const double value = asymptotic (x);
+		if (!isnan (value))
+			return value;
+		const double y = 1.0 - x;
+		if (reflected (x))
+			return complement (x, prefactor (x) / continued_fraction (y, x, beta_b, beta_a));
+		else
+			return prefactor (x) / continued_fraction (x, y, beta_a, beta_b);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Regularized incomplete beta function from its complement              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// NOTE:	When the complement is close to 1 (small B arguments), the
+	//			subtraction loses the precision, so the direct fraction is
+	//			evaluated instead. It converges slower, and if it does not
+	//			converge at all, then the subtraction is the best estimate
+	double complement (
+		double x,			// Argument value
+		double value		// Complement of the function value
+	) const {
+		if (value < 0.5)
+			return 1.0 - value;
+		const double temp = prefactor (x) / continued_fraction (x, 1.0 - x, beta_a, beta_b);
+		return isnan (temp) ? 1.0 - value : temp;
 	}
 
 //============================================================================//
@@ -98,7 +275,7 @@ public:
 		double b			// B argument of the beta function
 	) : beta_a (a),
 		beta_b (b),
-		beta_log (lgamma (a) + lgamma (b) - lgamma (a + b))
+		beta_log (beta_logarithm (a, b))
 	{
 		if (a <= 0.0)
 			throw invalid_argument ("SpecialBeta: The alpha value must be positive");
@@ -121,7 +298,7 @@ public:
 			if (x == 1.0) return 1.0;
 
 			// Common case
-			return incomplete (x, beta_a, beta_b, 0.0);
+			return incomplete (x) * Beta();
 		}
 		else throw invalid_argument ("IncompleteBeta: The argument must be in the range [0..1]");
 	}
@@ -141,11 +318,71 @@ public:
 			if (x == 1.0) return 1.0;
 
 			// Common case
-			return incomplete (x, beta_a, beta_b, beta_log);
+			return incomplete (x);
 		}
 		else throw invalid_argument ("RegIncompleteBeta: The argument must be in the range [0..1]");
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Regularized incomplete beta function for the array of arguments       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	// NOTE:	The continued fractions are evaluated for whole SIMD vectors of
+	//			arguments, so the argument array is processed by vector blocks
+	vector <double> RegIncompleteBeta (
+		const vector <double> &x	// Argument values
+	) const {
+
+		// Check the argument range
+		for (double value : x)
+			if (!(0.0 <= value && value <= 1.0))
+				throw invalid_argument ("RegIncompleteBeta: The argument must be in the range [0..1]");
+
+		// Process the arguments by vector blocks
+		const size_t size = x.size();
+		const size_t lanes = sizeof (Array::vdbl) / sizeof (double);
+		vector <double> result (size);
+		for (size_t i = 0; i < size; i += lanes) {
+			const size_t count = min (lanes, size - i);
+
+			// Gather the fraction arguments of the block. The unused lanes and
+			// the values known without the fraction get the zero argument,
+			// the fraction converges at once for
+			Array::vdbl vx, vy, va, vb;
+			for (size_t j = 0; j < lanes; j++) {
+				vx [j] = 0.0;
+				vy [j] = 1.0;
+				va [j] = beta_a;
+				vb [j] = beta_b;
+				if (j >= count) continue;
+				const double value = x [i + j];
+				result [i + j] = value == 0.0 || value == 1.0 ? value : asymptotic (value);
+				if (!isnan (result [i + j])) continue;
+				const bool flag = reflected (value);
+				vx [j] = flag ? 1.0 - value : value;
+				vy [j] = flag ? value : 1.0 - value;
+				va [j] = flag ? beta_b : beta_a;
+				vb [j] = flag ? beta_a : beta_b;
+			}
+
+			// Evaluate the fractions of the block at once
+			const Array::vdbl vh = continued_fraction (vx, vy, va, vb);
+
+			// Scatter the results of the block. The lanes, which fractions do
+			// not converge, are evaluated separately
+			for (size_t j = 0; j < count; j++) {
+				const double value = x [i + j];
+				if (!isnan (result [i + j])) continue;
+				if (isnan (vh [j]))
+					result [i + j] = incomplete (value);
+				else {
+					const double temp = prefactor (value) / vh [j];
+					result [i + j] = reflected (value) ? complement (value, temp) : temp;
+				}
+			}
+		}
+		return result;
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Beta function                                                         //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -0,0 +1,135 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#           ACCURACY AND SPEED OF INCOMPLETE GAMMA AGAINST BOOST.MATH          #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+// INFO:	The program compares the normalized incomplete gamma functions with
+//			"boost::math::gamma_p" and "boost::math::gamma_q" at their default
+//			policy. Every range of the shapes gets random shapes, uniform in
+//			the logarithmic scale, and the arguments spread around the shape
+//			by three standard deviations of the Gamma distribution. The lower
+//			and the upper functions get the logarithm of the gamma function
+//			of the shape, as the models give it. The relative error counts
+//			only the values above the smallest value to compare, and the time
+//			is the best of the runs per call. It returns a non-zero exit code
+//			if any error exceeds the tolerance. Build it with optimization:
+//
+//			g++ -std=c++17 -O2 -mavx2 gamma_benchmark.cpp
+# include	<boost/math/special_functions/gamma.hpp>
+# include	<algorithm>
+# include	<chrono>
+# include	<cstdio>
+# include	<cstdlib>
+# include	<random>
+# include	<vector>
+# include	"gamma.hpp"
+using namespace Model;
+
+// Count of random shapes for every range
+# define	BENCH_SHAPES		100000
+
+// Count of runs to take the best time of
+# define	BENCH_RUNS			5
+
+// The smallest value the relative error is checked for
+# define	BENCH_MIN_VALUE		1e-30
+
+// Largest relative error the functions may have
+# define	BENCH_TOLERANCE		1e-10
+
+//****************************************************************************//
+//      Arguments of the functions                                            //
+//****************************************************************************//
+struct GammaArgs {
+	double arg;						// Argument value
+	double shape;					// The shape value
+	double gamma_log;				// Logarithm of the gamma function of the shape
+	bool upper;						// Upper function flag
+};
+
+//****************************************************************************//
+//      Best time of the runs of a function per call in nanoseconds           //
+//****************************************************************************//
+template <typename F>
+static double Measure (
+	const vector <GammaArgs> &args,	// Arguments of the calls
+	F function,						// Function to time
+	vector <double> &results		// Results of the calls
+){
+	double best = INFINITY;
+	results.resize (args.size());
+	for (size_t i = 0; i < BENCH_RUNS; i++) {
+		const auto start = chrono::steady_clock::now();
+		for (size_t j = 0; j < args.size(); j++)
+			results [j] = function (args [j]);
+		const auto stop = chrono::steady_clock::now();
+		best = min (best, chrono::duration <double, nano> (stop - start).count());
+	}
+	return best / args.size();
+}
+
+//****************************************************************************//
+//      Compare the functions for a range of the shapes                       //
+//****************************************************************************//
+static double Compare (
+	double min,						// The smallest shape of the range
+	double max,						// The largest shape of the range
+	mt19937 &generator				// Random number engine
+){
+	// Random shapes and the arguments around them
+	uniform_real_distribution <double> power (log (min), log (max));
+	normal_distribution <double> spread (0.0, 1.0);
+	bernoulli_distribution flag (0.5);
+	vector <GammaArgs> args;
+	for (size_t i = 0; i < BENCH_SHAPES; i++) {
+		const double shape = exp (power (generator));
+		const double sigma = std::min (1.0, 3.0 / sqrt (shape));
+		const double arg = shape * exp (sigma * spread (generator));
+		args.push_back (GammaArgs {arg, shape, lgamma (shape), flag (generator)});
+	}
+
+	// Time both implementations
+	vector <double> ours, theirs;
+	const double time1 = Measure (args, [] (const GammaArgs &x) {
+		return NormalizedIncompleteGamma (x.arg, x.shape, x.gamma_log, x.upper);
+	}, ours);
+	const double time2 = Measure (args, [] (const GammaArgs &x) {
+		if (x.upper)
+			return boost::math::gamma_q (x.shape, x.arg);
+		else
+			return boost::math::gamma_p (x.shape, x.arg);
+	}, theirs);
+
+	// The largest relative error of the values to compare
+	double error = 0.0;
+	for (size_t i = 0; i < args.size(); i++)
+		if (theirs [i] > BENCH_MIN_VALUE)
+			error = std::max (error, fabs (ours [i] / theirs [i] - 1.0));
+
+	// Report the results
+	printf ("[%g, %g)\t%9.1e %9.0f ns %9.0f ns %6.1fx\n", min, max, error, time1, time2, time2 / time1);
+	return error;
+}
+
+//****************************************************************************//
+//      Compare the functions for all the ranges                              //
+//****************************************************************************//
+int main (void) {
+	mt19937 generator (1);
+	printf ("shape\t\t    error      time Boost.Math\n");
+	double error = 0.0;
+	error = max (error, Compare (1e-3, 10.0, generator));
+	error = max (error, Compare (10.0, 100.0, generator));
+	error = max (error, Compare (100.0, 1e4, generator));
+	error = max (error, Compare (1e4, 1e7, generator));
+	return error <= BENCH_TOLERANCE ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
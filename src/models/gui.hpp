@@ -29,6 +29,7 @@
 # include	"continuous/normal.hpp"
 # include	"continuous/laplace.hpp"
 # include	"continuous/asymmetric_laplace.hpp"
+# include	"continuous/mixture.hpp"
 # include	"../prop_notebook.hpp"
 # include	"../summary_window.hpp"
 
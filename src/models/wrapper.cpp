@@ -31,6 +31,8 @@
 # include	"continuous/normal.hpp"
 # include	"continuous/laplace.hpp"
 # include	"continuous/asymmetric_laplace.hpp"
+# include	"continuous/mixture.hpp"
+# include	"continuous/likelihood.hpp"
 
 //****************************************************************************//
 //      Random value generators                                               //
@@ -55,6 +57,12 @@
 		"Probability Density Function (PDF)")									\
 	.def ("CDF",		&class::CDF,		args ("x"),							\
 		"Cumulative Distribution Function (CDF)")								\
+	.def ("Quantiles",	&class::Quantiles,	args ("levels"),					\
+		"Quantile values for the target levels")								\
+	.def ("PDFs",		&class::PDFs,		args ("values"),					\
+		"Probability Density Function (PDF) for the argument values")			\
+	.def ("CDFs",		&class::CDFs,		args ("values"),					\
+		"Cumulative Distribution Function (CDF) for the argument values")		\
 	.def ("data",		&class::data,		return_internal_reference <> (),	\
 		"Extract internal data from the distribution")							\
 	.def (self_ns::str (self_ns::self))
@@ -161,6 +169,13 @@ BOOST_PYTHON_MODULE (models) {
 		.add_property ("RelError",	&ConfidenceInterval::RelError,
 			"Relative error of the value");
 
+//============================================================================//
+//      Expose "EstimatorType" enumeration to Python                          //
+//============================================================================//
+	enum_ <Likelihood::EstimatorType> ("EstimatorType")
+		.value ("MOMENTS",		Likelihood::MOMENTS)
+		.value ("LIKELIHOOD",	Likelihood::LIKELIHOOD);
+
 //============================================================================//
 //      Discrete distributions                                                //
 //============================================================================//
@@ -209,6 +224,8 @@ BOOST_PYTHON_MODULE (models) {
 		"Model for a Geometric distribution",
 		init <double> (args ("probability"),
 			"Create a new Geometric distribution"))
+		.def (init <double, double> (args ("probability", "tail"),
+			"Create a new Geometric distribution with the tail mass left outside the cached tables"))
 		.def (init <const Observations &> (args ("data"),
 			"Create a new Geometric distribution from empirical data"))
 
@@ -228,6 +245,8 @@ BOOST_PYTHON_MODULE (models) {
 		"Model for a Binomial distribution",
 		init <size_t, double> (args ("trials", "probability"),
 			"Create a new Binomial distribution"))
+		.def (init <size_t, double, double> (args ("trials", "probability", "tail"),
+			"Create a new Binomial distribution with the tail mass left outside the cached tables"))
 		.def (init <const Observations &> (args ("data"),
 			"Create a new Binomial distribution from empirical data"))
 
@@ -249,6 +268,8 @@ BOOST_PYTHON_MODULE (models) {
 		"Model for a Negative Binomial distribution",
 		init <size_t, double> (args ("successes", "probability"),
 			"Create a new Negative Binomial distribution"))
+		.def (init <size_t, double, double> (args ("successes", "probability", "tail"),
+			"Create a new Negative Binomial distribution with the tail mass left outside the cached tables"))
 		.def (init <const Observations &> (args ("data"),
 			"Create a new Negative Binomial distribution from empirical data"))
 
@@ -270,6 +291,8 @@ BOOST_PYTHON_MODULE (models) {
 		"Model for a Poisson distribution",
 		init <double> (args ("probability"),
 			"Create a new Poisson distribution"))
+		.def (init <double, double> (args ("probability", "tail"),
+			"Create a new Poisson distribution with the tail mass left outside the cached tables"))
 		.def (init <const Observations &> (args ("data"),
 			"Create a new Poisson distribution from empirical data"))
 
@@ -295,6 +318,12 @@ BOOST_PYTHON_MODULE (models) {
 
 		// Methods
 		BASE_CLASS_METHODS (Kolmogorov)
+		.def ("FiniteCDF",					&Kolmogorov::FiniteCDF,
+			args ("n", "d"),
+			"Exact CDF of the one-sample Kolmogorov-Smirnov statistic for the sample size")
+
+		// Static methods
+		.staticmethod ("FiniteCDF")
 
 		// Properties
 		BASE_CLASS_PROPERTIES (Kolmogorov);
@@ -572,6 +601,82 @@ BOOST_PYTHON_MODULE (models) {
 		CONTINUOUS_CLASS_PROPERTIES (AsymmetricLaplace)
 		.add_property ("Asymmetry",	&AsymmetricLaplace::Asymmetry,
 			"Asymmetry of the distrsibution");
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Expose "NormalMixture" class to Python                                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	GENERATORS (NormalMixture)
+	class_ <NormalMixture> ("NormalMixture",
+		"Model for a mixture of two Normal distributions",
+		init <const Observations &> (args ("data"),
+			"Fit a new mixture of two Normal distributions to empirical data by the EM algorithm"))
+
+		// Methods
+		BASE_CLASS_METHODS (NormalMixture)
+		.def ("Component",	&NormalMixture::Component,	return_value_policy <copy_const_reference> (),
+			args ("index"), "Component of the mixture")
+		.def ("Weight",		&NormalMixture::Weight,	args ("index"),
+			"Weight of the component")
+
+		// Properties
+		BASE_CLASS_PROPERTIES (NormalMixture);
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Expose "GammaMixture" class to Python                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	GENERATORS (GammaMixture)
+	class_ <GammaMixture> ("GammaMixture",
+		"Model for a mixture of two Gamma distributions",
+		init <const Observations &> (args ("data"),
+			"Fit a new mixture of two Gamma distributions to empirical data by the EM algorithm"))
+
+		// Methods
+		BASE_CLASS_METHODS (GammaMixture)
+		.def ("Component",	&GammaMixture::Component,	return_value_policy <copy_const_reference> (),
+			args ("index"), "Component of the mixture")
+		.def ("Weight",		&GammaMixture::Weight,	args ("index"),
+			"Weight of the component")
+
+		// Properties
+		BASE_CLASS_PROPERTIES (GammaMixture);
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Expose "LaplaceMixture" class to Python                               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	GENERATORS (LaplaceMixture)
+	class_ <LaplaceMixture> ("LaplaceMixture",
+		"Model for a mixture of two Laplace distributions",
+		init <const Observations &> (args ("data"),
+			"Fit a new mixture of two Laplace distributions to empirical data by the EM algorithm"))
+
+		// Methods
+		BASE_CLASS_METHODS (LaplaceMixture)
+		.def ("Component",	&LaplaceMixture::Component,	return_value_policy <copy_const_reference> (),
+			args ("index"), "Component of the mixture")
+		.def ("Weight",		&LaplaceMixture::Weight,	args ("index"),
+			"Weight of the component")
+
+		// Properties
+		BASE_CLASS_PROPERTIES (LaplaceMixture);
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Expose "LogisticMixture" class to Python                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	GENERATORS (LogisticMixture)
+	class_ <LogisticMixture> ("LogisticMixture",
+		"Model for a mixture of two Logistic distributions",
+		init <const Observations &> (args ("data"),
+			"Fit a new mixture of two Logistic distributions to empirical data by the EM algorithm"))
+
+		// Methods
+		BASE_CLASS_METHODS (LogisticMixture)
+		.def ("Component",	&LogisticMixture::Component,	return_value_policy <copy_const_reference> (),
+			args ("index"), "Component of the mixture")
+		.def ("Weight",		&LogisticMixture::Weight,	args ("index"),
+			"Weight of the component")
+
+		// Properties
+		BASE_CLASS_PROPERTIES (LogisticMixture);
 }
 /*
 ################################################################################
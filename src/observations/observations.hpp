@@ -8,10 +8,38 @@
 ################################################################################
 */
 # pragma	once
+# include	<memory>
 # include	"../templates/array.hpp"
 # include	"../templates/statistics.hpp"
+# include	"../templates/vmath.hpp"
 # include   "../models/range.hpp"
 
+//****************************************************************************//
+//      Struct "SufficientStats"                                              //
+//****************************************************************************//
+// INFO:	Sums of the observations that likelihood estimators of continuous
+//			models are built upon. Deviations are summed around the mean and
+//			the median values of the dataset to keep the sums precise. The
+//			sums which are not requested or not defined for the dataset are
+//			set to NAN
+struct SufficientStats {
+	enum StatsType {
+		SUM = 1,					// Sum of observed values
+		SQR_DEV = 2,				// Sum of squared deviations from the mean
+		ABS_DEV = 4,				// Sum of absolute deviations from the median
+		LOG = 8,					// Sum of logarithms log(x)
+		LOG1M = 16,					// Sum of logarithms log(1 - x)
+		ALL = 31					// All the sums
+	};
+
+	double count;					// Count of observed values (sum of the weights)
+	double sum;						// Sum of observed values
+	double sum_sqr_dev;				// Sum of squared deviations from the mean
+	double sum_abs_dev;				// Sum of absolute deviations from the median
+	double sum_log;					// Sum of logarithms log(x)
+	double sum_log1m;				// Sum of logarithms log(1 - x)
+};
+
 //****************************************************************************//
 //      Class "Observations"                                                  //
 //****************************************************************************//
@@ -23,7 +51,10 @@ class Observations
 protected:
 	Model::Range range;				// Values range
 	double *array;					// Array of observed values
+	double *weights;				// Weights of observed values (NULL if equal)
+	double *cumulative;				// Cumulative weights of ranked values
 	size_t size;					// Array size
+	double total;					// Sum of the weights
 	double mean;					// Mean value
 	double median;					// Median value
 
@@ -44,6 +75,14 @@ private:
 		for (size_t i = 0; i < shift_count; i++)
 			target [i] = source [i];
 		size -= count;
+
+		// Shift the weights and accumulate them again
+		if (weights) {
+			copy (weights + count, weights + count + size, weights);
+			accumulate_weights();
+		}
+		else
+			total = size;
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -53,16 +92,112 @@ private:
 		size_t count				// Count of observations to remove
 	){
 		size -= count;
+		total = weights ? (size ? cumulative [size - 1] : 0.0) : size;
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-//      Trim the observations from both sides                                 //
+//      Count of min observations which hold the percent of the weights       //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	void trim_both (
-		size_t count				// Count of observations to remove
+	size_t count_left (
+		double percent				// Percent of observations to cut off
+	) const {
+		if (!weights) return size * percent;
+		return upper_bound (cumulative, cumulative + size, total * percent) - cumulative;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of max observations which hold the percent of the weights       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t count_right (
+		double percent				// Percent of observations to cut off
+	) const {
+		if (!weights) return size * percent;
+		const double *last = lower_bound (cumulative, cumulative + size, total * (1.0 - percent));
+		return last < cumulative + size ? cumulative + size - last - 1 : 0;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Accumulate the weights of ranked observations                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void accumulate_weights (void) {
+		double sum = 0.0;
+		for (size_t i = 0; i < size; i++) {
+			sum += weights [i];
+			cumulative [i] = sum;
+		}
+		total = sum;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Rank the observations together with their weights                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void rank_weights (void) {
+
+		// Check the weights
+		for (size_t i = 0; i < size; i++)
+			if (!(weights [i] >= 0.0 && weights [i] < INFINITY))
+				throw invalid_argument ("Observations: The weights must be non-negative finite numbers");
+
+		// Sort the observations and their weights by the observed values
+		vector <pair <double, double> > pairs (size);
+		for (size_t i = 0; i < size; i++)
+			pairs [i] = pair <double, double> (array [i], weights [i]);
+		std::sort (pairs.begin(), pairs.end());
+		for (size_t i = 0; i < size; i++) {
+			array [i] = pairs [i].first;
+			weights [i] = pairs [i].second;
+		}
+
+		// Accumulate the weights for the quantiles
+		unique_ptr <double[]> sums (new double [size]);
+		cumulative = sums.get();
+		accumulate_weights();
+		if (!(total > 0.0))
+			throw invalid_argument ("Observations: The sum of the weights must be positive");
+		sums.release();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Value of the rank in ranked values with cumulative weights            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double weighted_rank (
+		const double values[],		// Ranked values
+		const double cumulative[],	// Cumulative weights of the values
+		size_t size,				// Array size
+		double rank					// Rank of the value in the cumulative weights
 	){
-		trim_left (count);
-		trim_right (count);
+		const size_t index = upper_bound (cumulative, cumulative + size, rank) - cumulative;
+		return values [min (index, size - 1)];
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Quantile of ranked values with cumulative weights                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The weights are frequencies of the values, so every value is
+//			treated as repeated by its weight. The rank of the level is taken
+//			in the units of the total weight, the same way as the index of
+//			unweighted values, and the value of the rank is found by binary
+//			search in the cumulative weights. So the integer weights give
+//			exactly the quantiles of the expanded dataset. The ranks between
+//			two values are interpolated
+	static double weighted_quantile (
+		const double values[],		// Ranked values
+		const double cumulative[],	// Cumulative weights of the values
+		size_t size,				// Array size
+		double level				// Quantile level to estimate
+	){
+		// Get the rank for the target level
+		const double rank = max (cumulative [size - 1] - 1.0, 0.0) * level;
+
+		// We do linear interpolation when a value resides between
+		// two ranks
+		const double pos = floor (rank);
+		const double gain = rank - pos;
+		const double value = weighted_rank (values, cumulative, size, pos);
+		if (gain)
+			return (1 - gain) * value + gain * weighted_rank (values, cumulative, size, pos + 1.0);
+		else
+			return value;
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -73,13 +208,44 @@ private:
 		size_t size					// Array size
 	) :	range (data, size),
 		array (new double [size]),
-		size (size)
+		weights (NULL),
+		cumulative (NULL),
+		size (size),
+		total (size)
 	{
 		// Sort the observations
 		Array::Copy (array, data, size);
 		Array::Sort (array, size);
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Store raw weighted observations                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	Observations (
+		const double data[],		// Raw observations to work with
+		const double weights[],		// Weights of the observations
+		size_t size					// Array size
+	) :	range (data, size),
+		array (NULL),
+		weights (NULL),
+		cumulative (NULL),
+		size (size),
+		total (0.0)
+	{
+		// Copy the observations with their weights
+		unique_ptr <double[]> values (new double [size]);
+		unique_ptr <double[]> scales (new double [size]);
+		Array::Copy (values.get(), data, size);
+		Array::Copy (scales.get(), weights, size);
+
+		// Sort them and take the ownership if the weights are correct
+		array = values.get();
+		Observations::weights = scales.get();
+		rank_weights();
+		values.release();
+		scales.release();
+	}
+
 //============================================================================//
 //      Protected methods                                                     //
 //============================================================================//
@@ -90,19 +256,150 @@ protected:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	Observations (
 		double data[],				// Transformed observations to store
+		double weights[],			// Weights of the observations (or NULL)
 		size_t size					// Array size
 	) :	range (data, size),
 		array (data),
-		size (size)
+		weights (weights),
+		cumulative (NULL),
+		size (size),
+		total (size)
 	{
+		// Free the arrays if the weights are rejected
+		unique_ptr <double[]> values (data);
+		unique_ptr <double[]> scales (weights);
+
 		// Sort the observations
-		Array::Sort (array, size);
+		if (weights)
+			rank_weights();
+		else
+			Array::Sort (array, size);
+		values.release();
+		scales.release();
 
 		// Estimate the mean and the median values
-		Observations::mean = Stats::Mean (array, size);
+		Observations::mean = weighted_mean();
 		Observations::median = Quantile (0.5);
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Mean value of the observations with their weights                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double weighted_mean (void) const {
+		if (!weights)
+			return Stats::Mean (array, size);
+		double sum = 0.0;
+		for (size_t i = 0; i < size; i++)
+			sum += weights [i] * array [i];
+		return sum / total;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Weighted mean of deviations from the center value in the power        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The sum is divided by the sum of the weights reduced by the degrees
+//			of freedom, so the sample estimators use the weights as counts
+	double weighted_moment (
+		double center,				// Center value to find deviations from
+		size_t power,				// Power of deviations
+		double dof = 0.0			// Degrees of freedom to subtract
+	) const {
+		double sum = 0.0;
+		for (size_t i = 0; i < size; i++) {
+			const double dev = array [i] - center;
+			double value = weights [i];
+			for (size_t k = 0; k < power; k++)
+				value *= dev;
+			sum += value;
+		}
+		return sum / (total - dof);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Weighted mean of absolute deviations from the center value            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double weighted_abs_dev (
+		double center				// Center value to find deviations from
+	) const {
+		double sum = 0.0;
+		for (size_t i = 0; i < size; i++)
+			sum += weights [i] * fabs (array [i] - center);
+		return sum / total;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Weighted median of deviations from the center value                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	template <typename F>
+	double weighted_median_dev (
+		double center,				// Center value to find deviations from
+		F func						// Function of a deviation
+	) const {
+		// Rank the deviations with their weights
+		vector <pair <double, double> > pairs (size);
+		for (size_t i = 0; i < size; i++)
+			pairs [i] = pair <double, double> (func (array [i] - center), weights [i]);
+		std::sort (pairs.begin(), pairs.end());
+
+		// Median of the ranked deviations
+		vector <double> values (size);
+		vector <double> sums (size);
+		double sum = 0.0;
+		for (size_t i = 0; i < size; i++) {
+			values [i] = pairs [i].first;
+			sums [i] = sum += pairs [i].second;
+		}
+		return weighted_quantile (values.data(), sums.data(), size, 0.5);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Weighted variation, skewness and kurtosis around the center value     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The degrees of freedom correct the squared deviations only. The
+//			higher moments are always divided by the sum of the weights
+	double weighted_variation (
+		double center,				// Center value to find deviations from
+		double dof					// Degrees of freedom to subtract
+	) const {
+		return sqrt (weighted_moment (center, 2, dof)) / center;
+	}
+
+	double weighted_skewness (
+		double center,				// Center value to find deviations from
+		double dof					// Degrees of freedom to subtract
+	) const {
+		return weighted_moment (center, 3) / pow (weighted_moment (center, 2, dof), 1.5);
+	}
+
+	double weighted_kurtosis (
+		double center,				// Center value to find deviations from
+		double dof					// Degrees of freedom to subtract
+	) const {
+		const double variance = weighted_moment (center, 2, dof);
+		return weighted_moment (center, 4) / (variance * variance);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Observed value of the rank (weights are counts of the values)         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double ranked (
+		size_t rank					// Rank of the value
+	) const {
+		if (weights)
+			return weighted_rank (array, cumulative, size, rank);
+		return array [rank];
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Copy of the weights for transformed observations                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double* copy_weights (void) const {
+		if (!weights) return NULL;
+		double *result = new double [size];
+		Array::Copy (result, weights, size);
+		return result;
+	}
+
 //============================================================================//
 //      Public methods                                                        //
 //============================================================================//
@@ -122,6 +419,17 @@ public:
 		Observations::median = Quantile (0.5);
 	}
 
+	// Weighted statistical sample
+	Observations (
+		const vector <double> data,	// Observations of a random value
+		const vector <double> weights	// Weights of the observations
+	) :	Observations (data.data(), weights.data(), min (data.size(), weights.size()))
+	{
+		// Estimate the mean and the median values
+		Observations::mean = weighted_mean();
+		Observations::median = Quantile (0.5);
+	}
+
 	// Statistical population
 	Observations (
 		const vector <double> data,	// Observations of a random value
@@ -134,6 +442,19 @@ public:
 		Observations::median = median;
 	}
 
+	// Weighted statistical population
+	Observations (
+		const vector <double> data,	// Observations of a random value
+		const vector <double> weights,	// Weights of the observations
+		double mean,				// Population mean
+		double median				// Population median
+	) :	Observations (data.data(), weights.data(), min (data.size(), weights.size()))
+	{
+		// Set the mean and the median values
+		Observations::mean = mean;
+		Observations::median = median;
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Copy constructor                                                      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -141,12 +462,17 @@ public:
 		const Observations &source	// The source object to copy
 	) :	range (source.range),
 		array (new double [source.size]),
+		weights (source.copy_weights()),
+		cumulative (source.weights ? new double [source.size] : NULL),
 		size (source.size),
+		total (source.total),
 		mean (source.mean),
 		median (source.median)
 	{
 		// Copy the data
 		Array::Copy (array, source.array, source.size);
+		if (cumulative)
+			Array::Copy (cumulative, source.cumulative, source.size);
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -156,13 +482,19 @@ public:
 		Observations &&source		// The source object to move
 	) :	range (source.range),
 		array (source.array),
+		weights (source.weights),
+		cumulative (source.cumulative),
 		size (source.size),
+		total (source.total),
 		mean (source.mean),
 		median (source.median)
 	{
 		// Reset the original object
 		source.array = NULL;
+		source.weights = NULL;
+		source.cumulative = NULL;
 		source.size = 0;
+		source.total = 0.0;
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -170,6 +502,8 @@ public:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual ~Observations (void) {
 		delete [] array;
+		delete [] weights;
+		delete [] cumulative;
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -179,7 +513,7 @@ public:
 		double percent				// Percent of observations to cut off
 	){
 		if (0.0 <= percent && percent <= 1.0)
-			trim_left (size * percent);
+			trim_left (count_left (percent));
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -189,7 +523,7 @@ public:
 		double percent				// Percent of observations to cut off
 	){
 		if (0.0 <= percent && percent <= 1.0)
-			trim_right (size * percent);
+			trim_right (count_right (percent));
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -198,8 +532,11 @@ public:
 	void TrimBoth (
 		double percent				// Percent of observations to cut off
 	){
-		if (0.0 <= percent && percent <= 1.0)
-			trim_both (size * percent);
+		if (0.0 <= percent && percent <= 1.0) {
+			const size_t count = count_right (percent);
+			trim_left (count_left (percent));
+			trim_right (min (count, size));
+		}
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -293,6 +630,100 @@ public:
 		return size;
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sum of the weights (count of observed values if not weighted)         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double TotalWeight (void) const {
+		return total;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Check if the observations are weighted                                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool Weighted (void) const {
+		return weights != NULL;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sufficient statistics of the dataset                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	Only the requested sums are accumulated, all of them in one SIMD
+//			pass over the observations. The logarithms are summed only if the
+//			observations are inside their domain. The weighted observations
+//			are summed with their weights, so the estimators see the weights
+//			as counts of the values
+	SufficientStats Sufficient (
+		unsigned stats = SufficientStats::ALL	// Sums to compute
+	) const {
+
+		// Use shortenings
+		using namespace VMath;
+
+		// Check which sums are requested and defined for the dataset
+		const bool need_sqr_dev = stats & SufficientStats::SQR_DEV;
+		const bool need_abs_dev = stats & SufficientStats::ABS_DEV;
+		const bool need_log = stats & SufficientStats::LOG && range.Min() >= 0.0;
+		const bool need_log1m = stats & SufficientStats::LOG1M && range.Max() <= 1.0;
+
+		// Vector sums of the lanes
+		vdbl sum = {};
+		vdbl sum_sqr_dev = {};
+		vdbl sum_abs_dev = {};
+		vdbl sum_log = {};
+		vdbl sum_log1m = {};
+		const vdbl center1 = splat (mean);
+		const vdbl center2 = splat (median);
+		auto accumulate = [&] (const vdbl &x, const vdbl &w) {
+			const vdbl dev1 = x - center1;
+			const vdbl dev2 = x - center2;
+			sum += w * x;
+			if (need_sqr_dev) sum_sqr_dev += w * dev1 * dev1;
+			if (need_abs_dev) sum_abs_dev += w * (dev2 < 0.0 ? -dev2 : dev2);
+			if (need_log) sum_log += w * vlog (x);
+			if (need_log1m) sum_log1m += w * vlog (1.0 - x);
+		};
+
+		// Process the whole vectors
+		const size_t bytes = sizeof (vdbl);
+		const size_t whole = size - size % VMATH_LANES;
+		const vdbl ones = splat (1.0);
+		for (size_t i = 0; i < whole; i += VMATH_LANES) {
+			vdbl x, w = ones;
+			memcpy (&x, array + i, bytes);
+			if (weights) memcpy (&w, weights + i, bytes);
+			accumulate (x, w);
+		}
+
+		// The tail is padded by zero weights of a value inside all the domains
+		if (whole < size) {
+			const size_t count = size - whole;
+			vdbl x = splat (0.5);
+			vdbl w = {};
+			memcpy (&x, array + whole, count * sizeof (double));
+			if (weights)
+				memcpy (&w, weights + whole, count * sizeof (double));
+			else
+				for (size_t i = 0; i < count; i++) w [i] = 1.0;
+			accumulate (x, w);
+		}
+
+		// Return the sufficient statistics
+		auto reduce = [] (const vdbl &x, bool need) {
+			double result = 0.0;
+			for (size_t i = 0; i < VMATH_LANES; i++)
+				result += x [i];
+			return need ? result : NAN;
+		};
+		return SufficientStats {
+			total,
+			reduce (sum, true),
+			reduce (sum_sqr_dev, need_sqr_dev),
+			reduce (sum_abs_dev, need_abs_dev),
+			reduce (sum_log, need_log),
+			reduce (sum_log1m, need_log1m)
+		};
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Ranked dataset                                                        //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -300,6 +731,29 @@ public:
 		return vector <double> (array, array + size);
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Ranked dataset without a copy                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const double* RankedData (void) const {
+		return array;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Weights of the ranked dataset without a copy (NULL if not weighted)   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const double* RankedWeights (void) const {
+		return weights;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Weights of the ranked dataset                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> Weights (void) const {
+		if (weights)
+			return vector <double> (weights, weights + size);
+		return vector <double> (size, 1.0);
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Values range                                                          //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -317,6 +771,10 @@ public:
 		// Check if the level is correct
 		if (0.0 <= level && level <= 1.0) {
 
+			// Weighted observations are ranked by the cumulative weights
+			if (weights)
+				return weighted_quantile (array, cumulative, size, level);
+
 			// Get the index value for the target level
 			const double index = (size - 1) * level;
 
@@ -399,6 +857,8 @@ public:
 //      Median of squared deviations from the mean value                      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	double MedianSqrDevFromMean (void) const {
+		if (weights)
+			return weighted_median_dev (Mean(), [] (double dev) {return dev * dev;});
 		return Stats::MedianSqrDev (array, size, Mean());
 	}
 
@@ -406,6 +866,8 @@ public:
 //      Median of absolute deviations from the mean value                     //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	double MedianAbsDevFromMean (void) const {
+		if (weights)
+			return weighted_median_dev (Mean(), [] (double dev) {return fabs (dev);});
 		return Stats::MedianAbsDev (array, size, Mean());
 	}
 
@@ -413,6 +875,8 @@ public:
 //      Median of signed deviations from the mean value                       //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	double MedianSignDevFromMean (void) const {
+		if (weights)
+			return weighted_median_dev (Mean(), [] (double dev) {return dev;});
 		return Stats::MedianSignDev (array, size, Mean());
 	}
 
@@ -420,6 +884,8 @@ public:
 //      Median of squared deviations from the median value                    //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	double MedianSqrDevFromMedian (void) const {
+		if (weights)
+			return weighted_median_dev (Median(), [] (double dev) {return dev * dev;});
 		return Stats::MedianSqrDev (array, size, Median());
 	}
 
@@ -427,6 +893,8 @@ public:
 //      Median of absolute deviations from the median value                   //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	double MedianAbsDevFromMedian (void) const {
+		if (weights)
+			return weighted_median_dev (Median(), [] (double dev) {return fabs (dev);});
 		return Stats::MedianAbsDev (array, size, Median());
 	}
 
@@ -434,6 +902,8 @@ public:
 //      Median of signed deviations from the median value                     //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	double MedianSignDevFromMedian (void) const {
+		if (weights)
+			return weighted_median_dev (Median(), [] (double dev) {return dev;});
 		return Stats::MedianSignDev (array, size, Median());
 	}
 
@@ -487,6 +957,8 @@ public:
 		// Size of the dataset
 		PropGroup size;
 		size.Append ("Data points", Size());
+		if (weights)
+			size.Append ("Total weight", TotalWeight());
 		summary.Prepend (size);
 
 		// Robust estimations
@@ -38,6 +38,23 @@ public:
 	) : Population (to_vector (py_list), mean, median)
 	{}
 
+	// Weighted population, where the weights are counts of the values
+	Population (
+		const vector <double> data,	// Population data
+		const vector <double> weights,	// Weights of the values
+		double mean,				// Population mean value
+		double median				// Population median value
+	) :	Observations (data, weights, mean, median)
+	{}
+
+	Population (
+		const pylist &py_list,		// Population data
+		const pylist &py_weights,	// Weights of the values
+		double mean,				// Population mean value
+		double median				// Population median value
+	) : Population (to_vector (py_list), to_vector (py_weights), mean, median)
+	{}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Copy constructor                                                      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -58,6 +75,8 @@ public:
 //      Variance of the dataset                                               //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double Variance (void) const override final {
+		if (weights)
+			return weighted_moment (Mean(), 2);
 		return Stats::SqrDevPopulation (array, size, Mean());
 	}
 
@@ -65,6 +84,8 @@ public:
 //      Standard deviation of the dataset                                     //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double StdDev (void) const override final {
+		if (weights)
+			return sqrt (weighted_moment (Mean(), 2));
 		return Stats::StdDevPopulation (array, size, Mean());
 	}
 
@@ -72,6 +93,8 @@ public:
 //      Standard error of the dataset                                         //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double StdErr (void) const override final {
+		if (weights)
+			return sqrt (weighted_moment (Mean(), 2) / total);
 		return Stats::StdErrPopulation (array, size, Mean());
 	}
 
@@ -79,6 +102,8 @@ public:
 //      Mean of squared deviations from the mean value                        //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double MeanSqrDevFromMean (void) const override final {
+		if (weights)
+			return weighted_moment (Mean(), 2);
 		return Stats::SqrDevPopulation (array, size, Mean());
 	}
 
@@ -86,6 +111,8 @@ public:
 //      Mean of absolute deviations from the mean value                       //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double MeanAbsDevFromMean (void) const override final {
+		if (weights)
+			return weighted_abs_dev (Mean());
 		return Stats::AbsDevPopulation (array, size, Mean());
 	}
 
@@ -93,6 +120,8 @@ public:
 //      Mean of squared deviations from the median value                      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double MeanSqrDevFromMedian (void) const override final {
+		if (weights)
+			return weighted_moment (Median(), 2);
 		return Stats::SqrDevPopulation (array, size, Median());
 	}
 
@@ -100,6 +129,8 @@ public:
 //      Mean of absolute deviations from the median value                     //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double MeanAbsDevFromMedian (void) const override final {
+		if (weights)
+			return weighted_abs_dev (Median());
 		return Stats::AbsDevPopulation (array, size, Median());
 	}
 
@@ -107,6 +138,8 @@ public:
 //      Mean of signed deviations from the median value                       //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double MeanSignDevFromMedian (void) const override final {
+		if (weights)
+			return weighted_moment (Median(), 1);
 		return Stats::SignDevPopulation (array, size, Median());
 	}
 
@@ -114,6 +147,8 @@ public:
 //      Variation around the mean value                                       //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double VariationAroundMean (void) const override final {
+		if (weights)
+			return weighted_variation (Mean(), 0.0);
 		return Stats::VariationPopulation (array, size, Mean());
 	}
 
@@ -121,6 +156,8 @@ public:
 //      Skewness around the mean value                                        //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double SkewnessAroundMean (void) const override final {
+		if (weights)
+			return weighted_skewness (Mean(), 0.0);
 		return Stats::SkewnessPopulation (array, size, Median());
 	}
 
@@ -128,6 +165,8 @@ public:
 //      Kurtosis around the mean value                                        //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double KurtosisAroundMean (void) const override final {
+		if (weights)
+			return weighted_kurtosis (Mean(), 0.0);
 		return Stats::KurtosisPopulation (array, size, Mean());
 	}
 
@@ -135,6 +174,8 @@ public:
 //      Variation around the median value                                     //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double VariationAroundMedian (void) const override final {
+		if (weights)
+			return weighted_variation (Median(), 0.0);
 		return Stats::VariationPopulation (array, size, Median());
 	}
 
@@ -142,6 +183,8 @@ public:
 //      Skewness around the median value                                      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double SkewnessAroundMedian (void) const override final {
+		if (weights)
+			return weighted_skewness (Median(), 0.0);
 		return Stats::SkewnessPopulation (array, size, Median());
 	}
 
@@ -149,6 +192,8 @@ public:
 //      Kurtosis around the median value                                      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double KurtosisAroundMedian (void) const override final {
+		if (weights)
+			return weighted_kurtosis (Median(), 0.0);
 		return Stats::KurtosisPopulation (array, size, Median());
 	}
 };
@@ -29,8 +29,9 @@ private:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	Sample (
 		double data[],				// Transformed observations to store
+		double weights[],			// Weights of the observations (or NULL)
 		size_t size					// Array size
-	) :	Observations (data, size)
+	) :	Observations (data, weights, size)
 	{}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -42,13 +43,13 @@ private:
 	) const {
 		// Check if the level is correct
 		if (0.0 <= level && level <= 1.0) {
-			const auto dist = Model::Binomial (size, p);
+			const auto dist = Model::Binomial (weights ? size_t (total) : size, p);
 			const double value = Quantile (p);
 			const double alpha = 1.0 - level;
 			const size_t quantile1 = dist.FloorQuantile (0.5 * alpha);
 			const size_t quantile2 = dist.CeilQuantile (1.0 - 0.5 * alpha);
-			const double lower = array [quantile1];
-			const double upper = array [quantile2];
+			const double lower = ranked (quantile1);
+			const double upper = ranked (quantile2);
 			const double precise_level = dist.CDF (quantile2) - dist.CDF (quantile1);
 			return Model::ConfidenceInterval (precise_level, value, Model::Range (lower, upper));
 		}
@@ -74,6 +75,19 @@ public:
 	) : Sample (to_vector (py_list))
 	{}
 
+	// Weighted sample, where the weights are counts of the values
+	Sample (
+		const vector <double> data,	// Sample data
+		const vector <double> weights	// Weights of the values
+	) :	Observations (data, weights)
+	{}
+
+	Sample (
+		const pylist &py_list,		// Sample data
+		const pylist &py_weights	// Weights of the values
+	) : Sample (to_vector (py_list), to_vector (py_weights))
+	{}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Copy constructor                                                      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -99,7 +113,7 @@ public:
 		double *data = new double [size];
 
 		// Return transformed observations
-		return Sample (Array::Abs (data, array, size), size);
+		return Sample (Array::Abs (data, array, size), copy_weights(), size);
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -115,7 +129,7 @@ public:
 		double *data = new double [size];
 
 		// Return transformed observations
-		return Sample (Array::Log (data, array, size), size);
+		return Sample (Array::Log (data, array, size), copy_weights(), size);
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -127,7 +141,7 @@ public:
 		double *data = new double [size];
 
 		// Return transformed observations
-		return Sample (Array::Exp (data, array, size), size);
+		return Sample (Array::Exp (data, array, size), copy_weights(), size);
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -145,7 +159,7 @@ public:
 		double *data = new double [size];
 
 		// Return transformed observations
-		return Sample (Array::Pow (data, array, size, power), size);
+		return Sample (Array::Pow (data, array, size, power), copy_weights(), size);
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -171,13 +185,15 @@ public:
 			data [i] = (pow (array[i], power) - 1.0) / power;
 
 		// Return transformed observations
-		return Sample (data, size);
+		return Sample (data, copy_weights(), size);
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Variance of the dataset                                               //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double Variance (void) const override final {
+		if (weights)
+			return weighted_moment (Mean(), 2, 1.0);
 		return Stats::SqrDevSample (array, size, Mean());
 	}
 
@@ -185,6 +201,8 @@ public:
 //      Standard deviation of the dataset                                     //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double StdDev (void) const override final {
+		if (weights)
+			return sqrt (weighted_moment (Mean(), 2, 1.0));
 		return Stats::StdDevSample (array, size, Mean());
 	}
 
@@ -192,6 +210,8 @@ public:
 //      Standard error of the dataset                                         //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double StdErr (void) const override final {
+		if (weights)
+			return sqrt (weighted_moment (Mean(), 2, 1.0) / total);
 		return Stats::StdErrSample (array, size, Mean());
 	}
 
@@ -199,6 +219,8 @@ public:
 //      Mean of squared deviations from the mean value                        //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double MeanSqrDevFromMean (void) const override final {
+		if (weights)
+			return weighted_moment (Mean(), 2, 1.0);
 		return Stats::SqrDevSample (array, size, Mean());
 	}
 
@@ -206,6 +228,8 @@ public:
 //      Mean of absolute deviations from the mean value                       //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double MeanAbsDevFromMean (void) const override final {
+		if (weights)
+			return weighted_abs_dev (Mean());
 		return Stats::AbsDevSample (array, size, Mean());
 	}
 
@@ -213,6 +237,8 @@ public:
 //      Mean of squared deviations from the median value                      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double MeanSqrDevFromMedian (void) const override final {
+		if (weights)
+			return weighted_moment (Median(), 2, 1.0);
 		return Stats::SqrDevSample (array, size, Median());
 	}
 
@@ -220,6 +246,8 @@ public:
 //      Mean of absolute deviations from the median value                     //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double MeanAbsDevFromMedian (void) const override final {
+		if (weights)
+			return weighted_abs_dev (Median());
 		return Stats::AbsDevSample (array, size, Median());
 	}
 
@@ -227,6 +255,8 @@ public:
 //      Mean of signed deviations from the median value                       //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double MeanSignDevFromMedian (void) const override final {
+		if (weights)
+			return weighted_moment (Median(), 1);
 		return Stats::SignDevSample (array, size, Median());
 	}
 
@@ -234,6 +264,8 @@ public:
 //      Variation around the mean value                                       //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double VariationAroundMean (void) const override final {
+		if (weights)
+			return weighted_variation (Mean(), 1.0);
 		return Stats::VariationSample (array, size, Mean());
 	}
 
@@ -241,6 +273,8 @@ public:
 //      Skewness around the mean value                                        //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double SkewnessAroundMean (void) const override final {
+		if (weights)
+			return weighted_skewness (Mean(), 1.0);
 		return Stats::SkewnessSample (array, size, Mean());
 	}
 
@@ -248,6 +282,8 @@ public:
 //      Kurtosis around the mean value                                        //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double KurtosisAroundMean (void) const override final {
+		if (weights)
+			return weighted_kurtosis (Mean(), 1.0);
 		return Stats::KurtosisSample (array, size, Mean());
 	}
 
@@ -255,6 +291,8 @@ public:
 //      Variation around the median value                                     //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double VariationAroundMedian (void) const override final {
+		if (weights)
+			return weighted_variation (Median(), 1.0);
 		return Stats::VariationSample (array, size, Median());
 	}
 
@@ -262,6 +300,8 @@ public:
 //      Skewness around the median value                                      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double SkewnessAroundMedian (void) const override final {
+		if (weights)
+			return weighted_skewness (Median(), 1.0);
 		return Stats::SkewnessSample (array, size, Median());
 	}
 
@@ -269,6 +309,8 @@ public:
 //      Kurtosis around the median value                                      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual double KurtosisAroundMedian (void) const override final {
+		if (weights)
+			return weighted_kurtosis (Median(), 1.0);
 		return Stats::KurtosisSample (array, size, Median());
 	}
 
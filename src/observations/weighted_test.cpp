@@ -0,0 +1,112 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#               WEIGHTED QUANTILES AGAINST THE EXPANDED DATASET                #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+// INFO:	The integer weights are counts of the values, so every quantile
+//			based statistic of the weighted observations must match the one
+//			of the dataset where every value is repeated by its weight. The
+//			program checks it for the fixed cases and for the random buckets
+//			of values with their counts, and returns a non-zero exit code on
+//			any mismatch. Build it as any wrapper of the module, for example:
+//
+//			g++ -std=c++17 -O2 -mavx2 -pthread weighted_test.cpp
+//				$(python3-config --includes --ldflags --embed) -lboost_python3
+# include	<boost/python.hpp>
+# include	<cstdio>
+# include	<cstdlib>
+# include	<random>
+# include	"sample.hpp"
+
+// Count of random datasets to check
+# define	TEST_DATASETS		1000
+
+// Relative tolerance of the comparison
+# define	TEST_TOLERANCE		1e-12
+
+//****************************************************************************//
+//      Compare the statistics of the weighted and the expanded datasets      //
+//****************************************************************************//
+static size_t Compare (
+	const vector <double> &values,	// Values of the buckets
+	const vector <double> &counts	// Counts of the values in the buckets
+){
+	// Expand the buckets into the repeated values
+	vector <double> expanded;
+	for (size_t i = 0; i < values.size(); i++)
+		expanded.insert (expanded.end(), size_t (counts [i]), values [i]);
+	const Sample weighted (values, counts);
+	const Sample sample (expanded);
+
+	// Compare two values up to the tolerance
+	size_t errors = 0;
+	auto check = [&] (const char *name, double level, double a, double b) {
+		if (fabs (a - b) > TEST_TOLERANCE * max (fabs (b), 1.0)) {
+			printf ("%s (%g): weighted %.17g, expanded %.17g\n", name, level, a, b);
+			errors++;
+		}
+	};
+
+	// Quantiles for the levels of the whole range
+	for (size_t i = 0; i <= 100; i++) {
+		const double level = i / 100.0;
+		check ("Quantile", level, weighted.Quantile (level), sample.Quantile (level));
+	}
+	check ("Quantile", 0.99, weighted.Quantile (0.99), sample.Quantile (0.99));
+
+	// Statistics built on the quantiles
+	check ("Median", 0.5, weighted.Median(), sample.Median());
+	check ("InterQuartileRange", 0.5, weighted.InterQuartileRange(), sample.InterQuartileRange());
+
+	// Deviations are compared with the median of the expanded deviations
+	auto deviation = [&] (double center) {
+		vector <double> devs;
+		for (const auto x : expanded)
+			devs.push_back (fabs (x - center));
+		return Sample (devs).Median();
+	};
+	check ("MedianAbsDevFromMedian", 0.5, weighted.MedianAbsDevFromMedian(), deviation (weighted.Median()));
+	check ("MedianAbsDevFromMean", 0.5, weighted.MedianAbsDevFromMean(), deviation (weighted.Mean()));
+	return errors;
+}
+
+//****************************************************************************//
+//      Check the fixed and the random datasets                               //
+//****************************************************************************//
+int main (void) {
+
+	// Buckets where most of the mass is in a single value
+	size_t errors = 0;
+	errors += Compare ({1.0, 2.0, 3.0}, {10.0, 10.0, 80.0});
+	errors += Compare ({1.0, 2.0, 3.0}, {98.0, 1.0, 1.0});
+	errors += Compare ({5.0}, {1.0});
+
+	// Random buckets with zero counts among them
+	mt19937 generator (1);
+	normal_distribution <double> value;
+	uniform_int_distribution <int> count (0, 20);
+	uniform_int_distribution <int> buckets (1, 50);
+	for (size_t n = 0; n < TEST_DATASETS; n++) {
+		vector <double> values, counts;
+		const size_t size = buckets (generator);
+		for (size_t i = 0; i < size; i++) {
+			values.push_back (value (generator));
+			counts.push_back (count (generator));
+		}
+		counts [0] += 1.0;
+		errors += Compare (values, counts);
+	}
+
+	// Report the result
+	printf ("%zu mismatches\n", errors);
+	return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -20,6 +20,8 @@
 		"Values range")															\
 	.def ("Data",				&class::Data,									\
 		"Ranked dataset")														\
+	.def ("Weights",			&class::Weights,								\
+		"Weights of the ranked dataset")										\
 	.def ("TrimMin",			&class::TrimMin,			args ("percent"),	\
 		"Trim the target percent of observed min values")						\
 	.def ("TrimMax",			&class::TrimMax,			args ("percent"),	\
@@ -54,6 +56,10 @@
 # define	BASE_CLASS_PROPERTIES(class) 										\
 	.add_property ("Size",						&class::Size,					\
 		"Count of observed values in the dataset")								\
+	.add_property ("TotalWeight",				&class::TotalWeight,			\
+		"Sum of the weights (count of observed values if not weighted)")		\
+	.add_property ("Weighted",					&class::Weighted,				\
+		"Check if the observations are weighted")								\
 	.add_property ("LowerQuartile",				&class::LowerQuartile,			\
 		"Lower quartile of the dataset")										\
 	.add_property ("UpperQuartile",				&class::UpperQuartile,			\
@@ -137,6 +143,12 @@ BOOST_PYTHON_MODULE (observations) {
 		.def (init <const vector <double>&, double, double>
 			(args ("data", "mean", "median"),
 			"Initialize a statistical population from data"))
+		.def (init <const pylist&, const pylist&, double, double>
+			(args ("data", "weights", "mean", "median"),
+			"Initialize a statistical population from weighted data"))
+		.def (init <const vector <double>&, const vector <double>&, double, double>
+			(args ("data", "weights", "mean", "median"),
+			"Initialize a statistical population from weighted data"))
 
 		// Methods
 		BASE_CLASS_METHODS(Population)
@@ -153,6 +165,11 @@ BOOST_PYTHON_MODULE (observations) {
 			"Initialize a statistical sample from data"))
 		.def (init <const vector <double>&> (args ("data"),
 			"Initialize a statistical sample from data"))
+		.def (init <const pylist&, const pylist&> (args ("data", "weights"),
+			"Initialize a statistical sample from weighted data"))
+		.def (init <const vector <double>&, const vector <double>&>
+			(args ("data", "weights"),
+			"Initialize a statistical sample from weighted data"))
 
 		// Methods
 		BASE_CLASS_METHODS(Sample)
@@ -0,0 +1,252 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#               LEAST SQUARES SOLVERS FOR THE REGRESSION MODELS                #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<cmath>
+# include	<cfloat>
+# include	<thread>
+# include	<vector>
+# include	<algorithm>
+# include	"../templates/array.hpp"
+
+// Count of values every pass over the columns processes at once
+# define	LEAST_SQUARES_BLOCK	256
+
+// Minimal count of values every thread processes
+# define	LEAST_SQUARES_CHUNK	16384
+
+// Use shortenings
+using namespace std;
+
+//****************************************************************************//
+//      Name space "LeastSquares"                                             //
+//****************************************************************************//
+// INFO:	The solvers factorize the Gram matrix of the columns as U' * D * U,
+//			where U is the unit upper triangular matrix and D holds the squared
+//			norms of the orthogonalized columns. The response values are the
+//			extra last column, so the last column of U keeps the projections
+//			of the response to the orthogonalized columns, and the last item
+//			of D is the residual sum of squares. All the matrices are stored
+//			by rows with the stride of "count + 1"
+namespace LeastSquares
+{
+//****************************************************************************//
+//      Count of threads to process the dataset of the given size             //
+//****************************************************************************//
+inline size_t Threads (
+	size_t size						// Size of the dataset
+){
+	const size_t chunks = (size + LEAST_SQUARES_CHUNK - 1) / LEAST_SQUARES_CHUNK;
+	return max (min (size_t (max (thread::hardware_concurrency(), 1u)), chunks), size_t (1));
+}
+
+//****************************************************************************//
+//      Split the dataset between the threads and process the parts           //
+//****************************************************************************//
+// NOTE:	The parts are aligned to the blocks, so every thread may process
+//			its part block by block
+template <typename F>
+void Parallel (
+	size_t size,					// Size of the dataset
+	size_t threads,					// Count of threads
+	F func							// Function (thread, begin, end) to call
+){
+	// Small datasets are processed in the current thread
+	if (threads == 1) {
+		func (0, 0, size);
+		return;
+	}
+
+	// Run the threads and wait for them
+	const size_t blocks = (size + LEAST_SQUARES_BLOCK - 1) / LEAST_SQUARES_BLOCK;
+	vector <thread> pool;
+	for (size_t t = 0; t < threads; t++) {
+		const size_t begin = t * blocks / threads * LEAST_SQUARES_BLOCK;
+		const size_t end = min ((t + 1) * blocks / threads * LEAST_SQUARES_BLOCK, size);
+		pool.push_back (thread (func, t, begin, end));
+	}
+	for (auto &worker : pool)
+		worker.join();
+}
+
+//****************************************************************************//
+//      Orthogonalize the columns by the Gram-Schmidt process                 //
+//****************************************************************************//
+// INFO:	The classical Gram-Schmidt process with one reorthogonalization
+//			pass is as stable as the Householder QR. Every column takes three
+//			sweeps over the rows: the first one finds the projections, the
+//			second one subtracts them and finds the projections again, and
+//			the last one subtracts the corrections. The dot products are
+//			accumulated block by block, so a block of the current column stays
+//			in the cache for all the previous columns. The rows are split
+//			between the threads for every sweep. The last column becomes the
+//			least squares residuals. Returns false if the columns (except the
+//			last one) are linearly dependent
+inline bool Orthogonalize (
+	double basis[],					// Columns to orthogonalize in place
+	size_t size,					// Size of the columns
+	size_t count,					// Count of the columns (except the response)
+	vector <double> &unit,			// Unit upper triangular matrix
+	vector <double> &diag			// Squared norms of the orthogonalized columns
+){
+	const size_t stride = count + 1;
+	unit.assign (stride * stride, 0.0);
+	diag.assign (stride, 0.0);
+	const size_t threads = Threads (size);
+	vector <double> partial (threads * stride);
+	vector <double> proj (stride);
+
+	// Orthogonalize every column against all the previous ones
+	for (size_t j = 0; j < stride; j++) {
+		double *column = basis + j * size;
+		const size_t sweeps = j ? 3 : 1;
+		double norm2 = 0.0;
+		for (size_t sweep = 0; sweep < sweeps; sweep++) {
+			const bool subtract = sweep > 0;
+			const bool project = sweep + 1 < sweeps;
+
+			// Every thread finds the dot products and the squared norm of its part
+			fill (partial.begin(), partial.end(), 0.0);
+			Parallel (size, threads, [&, j] (size_t t, size_t begin, size_t end) {
+				double *dots = partial.data() + t * stride;
+				for (size_t i = begin; i < end; i += LEAST_SQUARES_BLOCK) {
+					const size_t n = min (size_t (LEAST_SQUARES_BLOCK), end - i);
+					if (subtract)
+						for (size_t k = 0; k < j; k++)
+							Array::ScaledSub (column + i, basis + k * size + i, n, proj[k]);
+					if (project)
+						for (size_t k = 0; k < j; k++)
+							dots[k] += Array::SumMul (basis + k * size + i, column + i, n);
+					dots[j] += Array::SumSqr (column + i, n);
+				}
+			});
+
+			// Collect the sums from all the threads
+			for (size_t k = 0; k <= j; k++) {
+				double sum = 0.0;
+				for (size_t t = 0; t < threads; t++)
+					sum += partial [t * stride + k];
+				proj[k] = sum;
+			}
+			if (!sweep) norm2 = proj[j];
+
+			// Projections to the orthogonalized columns
+			if (project)
+				for (size_t k = 0; k < j; k++) {
+					proj[k] /= diag[k];
+					unit [k * stride + j] += proj[k];
+				}
+		}
+
+		// Squared norm of the orthogonalized column
+		diag[j] = proj[j];
+		if (j < count && !(diag[j] > norm2 * DBL_EPSILON))
+			return false;
+	}
+	return true;
+}
+
+//****************************************************************************//
+//      Factorize the Gram matrix in place                                    //
+//****************************************************************************//
+// NOTE:	Only the upper triangle of the Gram matrix is used. It becomes the
+//			unit matrix of the factorization. The Gram matrix squares the
+//			condition number of the columns, so the function returns false
+//			for the columns which are linearly dependent in the working
+//			precision
+inline bool Factorize (
+	vector <double> &gram,			// Gram matrix of the columns and the response
+	size_t count,					// Count of the columns (except the response)
+	vector <double> &diag			// Squared norms of the orthogonalized columns
+){
+	const size_t stride = count + 1;
+	diag.assign (stride, 0.0);
+	for (size_t j = 0; j < stride; j++) {
+
+		// Projections of the column to the previous orthogonalized columns
+		for (size_t k = 0; k < j; k++) {
+			double value = gram [k * stride + j];
+			for (size_t m = 0; m < k; m++)
+				value -= gram [m * stride + k] * diag[m] * gram [m * stride + j];
+			gram [k * stride + j] = value / diag[k];
+		}
+
+		// Squared norm of the orthogonalized column
+		const double norm2 = gram [j * stride + j];
+		double value = norm2;
+		for (size_t m = 0; m < j; m++)
+			value -= gram [m * stride + j] * gram [m * stride + j] * diag[m];
+		if (j < count && !(value > norm2 * DBL_EPSILON))
+			return false;
+		diag[j] = max (value, 0.0);
+		gram [j * stride + j] = 1.0;
+	}
+	return true;
+}
+
+//****************************************************************************//
+//      Least squares coefficients from the factorization                     //
+//****************************************************************************//
+inline void Solve (
+	const vector <double> &unit,	// Unit upper triangular matrix
+	size_t count,					// Count of the columns (except the response)
+	double coeffs[]					// Regression coefficients
+){
+	// Back substitution for the regression coefficients
+	const size_t stride = count + 1;
+	for (size_t j = count; j-- > 0;) {
+		double coeff = unit [j * stride + count];
+		for (size_t k = j + 1; k < count; k++)
+			coeff -= unit [j * stride + k] * coeffs[k];
+		coeffs[j] = coeff;
+	}
+}
+
+//****************************************************************************//
+//      Inverse of the Gram matrix from the factorization                     //
+//****************************************************************************//
+// NOTE:	The inverse Gram matrix scaled by the residual variance is the
+//			covariance matrix of the regression coefficients. The result is
+//			the square matrix of the size "count"
+inline vector <double> Inverse (
+	const vector <double> &unit,	// Unit upper triangular matrix
+	const vector <double> &diag,	// Squared norms of the orthogonalized columns
+	size_t count					// Count of the columns (except the response)
+){
+	// Inverse of the unit matrix. Every row is found separately
+	const size_t stride = count + 1;
+	vector <double> inverse (count * count, 0.0);
+	for (size_t j = 0; j < count; j++) {
+		double *row = inverse.data() + j * count;
+		row[j] = 1.0;
+		for (size_t k = j + 1; k < count; k++) {
+			double value = 0.0;
+			for (size_t m = j; m < k; m++)
+				value -= row[m] * unit [m * stride + k];
+			row[k] = value;
+		}
+	}
+
+	// Product of the inverse unit matrices and the inverse norms
+	vector <double> result (count * count);
+	for (size_t j = 0; j < count; j++)
+		for (size_t l = j; l < count; l++) {
+			double value = 0.0;
+			for (size_t k = l; k < count; k++)
+				value += inverse [j * count + k] * inverse [l * count + k] / diag[k];
+			result [j * count + l] = result [l * count + j] = value;
+		}
+	return result;
+}
+}
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
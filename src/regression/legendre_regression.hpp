@@ -70,12 +70,19 @@ public:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Constructor                                                           //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	Lean polynomials are not stored as full vectors. They are evaluated
+//			block by block on every use instead
 	LegendrePolynomials (
 		double x[],				// X values
 		size_t size,			// Number of the X values
-		size_t degree			// Polynomial degree
-	) : OrthogonalFunctions (x, size, degree)
+		size_t degree,			// Polynomial degree
+		bool lean = false,		// Do not store the polynomials
+		const double w[] = NULL	// Weights of the X values (or NULL)
+	) : OrthogonalFunctions (x, size, degree, max (degree, size_t (1)) + 1, w)
 	{
+		// Lean polynomials are evaluated on demand
+		if (lean) return;
+
 		// Initial polynomials for the recurrent polynomials evaluation procedure
 		mvector poly (size);
 		mvector poly0 (1.0, size);
@@ -88,6 +95,16 @@ public:
 			funcs.push_back (function);
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of the polynomials for the lower degree                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The zero degree keeps the linear polynomial as the constructor does
+	virtual size_t CountFor (
+		size_t degree			// Polynomial degree not greater than the set one
+	) const override final {
+		return max (degree, size_t (1)) + 1;
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Calculate values of all the orthogonal polynomials for the target X   //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -101,6 +118,77 @@ public:
 		// Evaluate recurrent polynomials for the target X value
 		return RecurrentPolynomials (x, 0.0, 1.0, x, degree);
 	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Values of all the orthogonal polynomials for a block of X values      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual void FuncBlock (
+		const double x[],		// X values to calculate the functions for
+		double result[],		// Values of the orthogonal functions
+		size_t size				// Number of the X values
+	) const override final {
+
+		// Initial polynomials are the constant and the mapped X values
+		fill (result, result + size, 1.0);
+		Convert (x, result + size, size);
+
+		// Evaluate the next recurrent polynomials until the target degree is achieved
+		for (size_t j = 2; j < count; j++) {
+			const double *p2 = result + (j - 2) * size;
+			const double *p1 = result + (j - 1) * size;
+			const double *arg = result + size;
+			double *p0 = result + j * size;
+			for (size_t i = 0; i < size; i++)
+				p0[i] = (arg[i] * p1[i] * (2 * j - 1) - p2[i] * (j - 1)) / j;
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Orthogonal expansion for a block of X values                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The sum is computed by the Clenshaw recurrence running from the
+//			highest polynomial degree down to zero degree. The recurrence
+//			keeps two previous terms for every X value, and the inner loop
+//			goes across the X values to let the compiler vectorize it
+	virtual void Expansion (
+		const double coeffs[],	// Coefficients of the expansion
+		const double x[],		// X values to calculate the expansion for
+		double result[],		// Values of the expansion
+		size_t size				// Number of the X values
+	) const override final {
+
+		// Check the arguments range and map them to the orthogonality domain
+		alignas (SIMD_VSIZE) double args [ORTHOGONAL_BLOCK];
+		Convert (x, args, size);
+
+		// Clenshaw recurrence terms
+		alignas (SIMD_VSIZE) double temp1 [ORTHOGONAL_BLOCK] = {};
+		alignas (SIMD_VSIZE) double temp2 [ORTHOGONAL_BLOCK] = {};
+		double *b2 = temp1;
+		double *b1 = temp2;
+		double *b0 = result;
+
+		// Run the recurrence from the highest degree down to zero degree
+		for (size_t k = count; k-- > 0;) {
+
+			// The coefficients of the Legendre polynomials recurrence
+			const double alpha = double (2 * k + 1) / double (k + 1);
+			const double beta = -double (k + 1) / double (k + 2);
+			const double c = coeffs[k];
+			for (size_t i = 0; i < size; i++)
+				b0[i] = c + alpha * args[i] * b1[i] + beta * b2[i];
+
+			// Swap the buffers for the next round
+			double *ptr = b2;
+			b2 = b1;
+			b1 = b0;
+			b0 = ptr;
+		}
+
+		// Copy the sum into the target array, if it is in a temporary buffer
+		if (b1 != result)
+			copy (b1, b1 + size, result);
+	}
 };
 
 //****************************************************************************//
@@ -119,12 +207,20 @@ private:
 	LegendreRegression (
 		double x[],				// Predictors (independent variables)
 		double y[],				// Response (dependent variables)
+		double w[],				// Weights of the observations (or NULL)
 		size_t size,			// Size of the dataset
-		size_t degree			// Polynomial degree
-	) :	OrthogonalRegression (y, new LegendrePolynomials (Sort (x, y, size), size, degree))
+		size_t degree,			// Polynomial degree
+		bool lean,				// Do not store the polynomials
+		bool exact,				// Find the least squares coefficients
+		LossFunction loss,		// Loss function of the regression
+		bool sorted				// X values are sorted in ascending order
+	) :	OrthogonalRegression (y, new LegendrePolynomials (Sort (x, y, w, size, sorted), size, degree, lean, w), loss, w)
 	{
 		// Approximate the dependent variables by the regression
-		Approximate();
+		Approximate (exact);
+
+		// Refit the regression by the robust loss function
+		Robust();
 	}
 
 //============================================================================//
@@ -138,15 +234,48 @@ public:
 	LegendreRegression (
 		vector <double> x,		// Predictors (independent variables)
 		vector <double> y,		// Response (dependent variables)
-		size_t degree			// Polynomial degree
-	) :	LegendreRegression (x.data(), y.data(), min (x.size(), y.size()), degree)
+		size_t degree,			// Polynomial degree
+		bool lean = false,		// Do not store the polynomials
+		bool exact = false,		// Find the least squares coefficients
+		LossFunction loss = MSE,	// Loss function of the regression
+		bool sorted = false		// X values are sorted in ascending order
+	) :	LegendreRegression (x.data(), y.data(), NULL, min (x.size(), y.size()), degree, lean, exact, loss, sorted)
 	{}
 
 	LegendreRegression (
 		const pylist &x,		// Predictors (independent variables)
 		const pylist &y,		// Response (dependent variables)
-		size_t degree			// Polynomial degree
-	) : LegendreRegression (to_vector (x), to_vector (y), degree)
+		size_t degree,			// Polynomial degree
+		bool lean = false,		// Do not store the polynomials
+		bool exact = false,		// Find the least squares coefficients
+		LossFunction loss = MSE,	// Loss function of the regression
+		bool sorted = false		// X values are sorted in ascending order
+	) : LegendreRegression (to_vector (x), to_vector (y), degree, lean, exact, loss, sorted)
+	{}
+
+	// Weighted regression, where the weights are counts of the observations
+	LegendreRegression (
+		vector <double> x,		// Predictors (independent variables)
+		vector <double> y,		// Response (dependent variables)
+		vector <double> w,		// Weights of the observations
+		size_t degree,			// Polynomial degree
+		bool lean = false,		// Do not store the polynomials
+		bool exact = false,		// Find the least squares coefficients
+		LossFunction loss = MSE,	// Loss function of the regression
+		bool sorted = false		// X values are sorted in ascending order
+	) :	LegendreRegression (x.data(), y.data(), w.data(), min ({x.size(), y.size(), w.size()}), degree, lean, exact, loss, sorted)
+	{}
+
+	LegendreRegression (
+		const pylist &x,		// Predictors (independent variables)
+		const pylist &y,		// Response (dependent variables)
+		const pylist &w,		// Weights of the observations
+		size_t degree,			// Polynomial degree
+		bool lean = false,		// Do not store the polynomials
+		bool exact = false,		// Find the least squares coefficients
+		LossFunction loss = MSE,	// Loss function of the regression
+		bool sorted = false		// X values are sorted in ascending order
+	) : LegendreRegression (to_vector (x), to_vector (y), to_vector (w), degree, lean, exact, loss, sorted)
 	{}
 };
 
@@ -155,7 +284,7 @@ public:
 //****************************************************************************//
 ostream& operator << (ostream &stream, const LegendreRegression &object)
 {
-	stream << object.Summary ("Legendre regression (MSE)");
+	stream << object.Summary ("Legendre regression (" + object.LossName() + ")");
 	return stream;
 }
 /*
@@ -26,11 +26,17 @@ private:
 	LinearRegression (
 		double x[],				// Predictors (independent variables)
 		double y[],				// Response (dependent variables)
-		size_t size				// Size of the dataset
-	) :	OrthogonalRegression (y, new LegendrePolynomials (Sort (x, y, size), size, 0))
+		double w[],				// Weights of the observations (or NULL)
+		size_t size,			// Size of the dataset
+		LossFunction loss,		// Loss function of the regression
+		bool sorted				// X values are sorted in ascending order
+	) :	OrthogonalRegression (y, new LegendrePolynomials (Sort (x, y, w, size, sorted), size, 0, false, w), loss, w)
 	{
 		// Approximate the dependent variables by the regression
 		Approximate ();
+
+		// Refit the regression by the robust loss function
+		Robust();
 	}
 
 //============================================================================//
@@ -43,14 +49,37 @@ public:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	LinearRegression (
 		vector <double> x,		// Predictors (independent variables)
-		vector <double> y		// Response (dependent variables)
-	) :	LinearRegression (x.data(), y.data(), min (x.size(), y.size()))
+		vector <double> y,		// Response (dependent variables)
+		LossFunction loss = MSE,	// Loss function of the regression
+		bool sorted = false		// X values are sorted in ascending order
+	) :	LinearRegression (x.data(), y.data(), NULL, min (x.size(), y.size()), loss, sorted)
+	{}
+
+	LinearRegression (
+		const pylist &x,		// Predictors (independent variables)
+		const pylist &y,		// Response (dependent variables)
+		LossFunction loss = MSE,	// Loss function of the regression
+		bool sorted = false		// X values are sorted in ascending order
+	) : LinearRegression (to_vector (x), to_vector (y), loss, sorted)
+	{}
+
+	// Weighted regression, where the weights are counts of the observations
+	LinearRegression (
+		vector <double> x,		// Predictors (independent variables)
+		vector <double> y,		// Response (dependent variables)
+		vector <double> w,		// Weights of the observations
+		LossFunction loss = MSE,	// Loss function of the regression
+		bool sorted = false		// X values are sorted in ascending order
+	) :	LinearRegression (x.data(), y.data(), w.data(), min ({x.size(), y.size(), w.size()}), loss, sorted)
 	{}
 
 	LinearRegression (
 		const pylist &x,		// Predictors (independent variables)
-		const pylist &y			// Response (dependent variables)
-	) : LinearRegression (to_vector (x), to_vector (y))
+		const pylist &y,		// Response (dependent variables)
+		const pylist &w,		// Weights of the observations
+		LossFunction loss = MSE,	// Loss function of the regression
+		bool sorted = false		// X values are sorted in ascending order
+	) : LinearRegression (to_vector (x), to_vector (y), to_vector (w), loss, sorted)
 	{}
 };
 
@@ -59,7 +88,7 @@ public:
 //****************************************************************************//
 ostream& operator << (ostream &stream, const LinearRegression &object)
 {
-	stream << object.Summary ("Linear regression (MSE)");
+	stream << object.Summary ("Linear regression (" + object.LossName() + ")");
 	return stream;
 }
 /*
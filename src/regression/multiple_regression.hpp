@@ -0,0 +1,545 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#               MULTIPLE LINEAR REGRESSION BY SEVERAL PREDICTORS               #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"least_squares.hpp"
+# include	"../templates/vector.hpp"
+# include	"../object_summary.hpp"
+# include	"../python_helpers.hpp"
+
+// Use shortenings
+using namespace Math;
+using mvector = Vector <double>;
+
+//****************************************************************************//
+//      Class "MultipleRegression"                                            //
+//****************************************************************************//
+// INFO:	The regression is y = A[0] + A[1] * x1 + ... + A[p] * xp. The
+//			predictors are stored by columns and are read in place, so the
+//			regression keeps the response values and the residuals only. All
+//			the columns are centered by their mean values before the fitting,
+//			which removes the intercept from the factorization and keeps the
+//			Gram matrix well conditioned for the predictors far from zero
+class MultipleRegression
+{
+//============================================================================//
+//      Least squares solver type                                             //
+//============================================================================//
+public:
+	enum SolverType {
+		CHOLESKY,						// Factorization of the Gram matrix
+		QR								// Orthogonalization of the predictors
+	};
+
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	SolverType solver;					// Least squares solver type
+	size_t features;					// Count of the predictors
+	mvector values;						// Original response values
+	mvector residuals;					// Regression residuals
+	mvector coeffs;						// Regression coefficients
+	mvector variances;					// Variances of the coefficients (unscaled)
+	double total_ss;					// Total sum of squares (TSS)
+	double residual_ss;					// Residual sum of squares (RSS)
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Mean values of the predictors and the response                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> Means (
+		const double x[],				// Predictors stored by columns
+		size_t threads					// Count of threads
+	) const {
+		const size_t size = values.Size();
+		const size_t stride = features + 1;
+		vector <double> partial (threads * stride, 0.0);
+		LeastSquares::Parallel (size, threads, [&] (size_t t, size_t begin, size_t end) {
+			double *sums = partial.data() + t * stride;
+			for (size_t k = 0; k < features; k++)
+				sums[k] = Array::Sum (x + k * size + begin, end - begin);
+			sums [features] = Array::Sum (values.Data() + begin, end - begin);
+		});
+
+		// Collect the sums from all the threads
+		vector <double> means (stride, 0.0);
+		for (size_t t = 0; t < threads; t++)
+			for (size_t k = 0; k < stride; k++)
+				means[k] += partial [t * stride + k];
+		for (auto &mean : means)
+			mean /= size;
+		return means;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Gram matrix of the centered predictors and the response               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	Every thread centers a block of all the columns into its buffer and
+//			accumulates the upper triangle of its own Gram matrix from it, so
+//			every value of the predictors is read from the memory only once
+	vector <double> Gram (
+		const double x[],				// Predictors stored by columns
+		const vector <double> &means,	// Mean values of the columns
+		size_t threads					// Count of threads
+	) const {
+		const size_t size = values.Size();
+		const size_t stride = features + 1;
+		vector <double> partial (threads * stride * stride, 0.0);
+		LeastSquares::Parallel (size, threads, [&] (size_t t, size_t begin, size_t end) {
+			double *gram = partial.data() + t * stride * stride;
+			vector <double> block (stride * LEAST_SQUARES_BLOCK);
+			for (size_t i = begin; i < end; i += LEAST_SQUARES_BLOCK) {
+				const size_t n = min (size_t (LEAST_SQUARES_BLOCK), end - i);
+
+				// Center the block of the columns
+				for (size_t k = 0; k < stride; k++) {
+					const double *column = k < features ? x + k * size + i : values.Data() + i;
+					double *target = block.data() + k * n;
+					for (size_t m = 0; m < n; m++)
+						target[m] = column[m] - means[k];
+				}
+
+				// Dot products of all the pairs of the columns
+				for (size_t j = 0; j < stride; j++)
+					for (size_t k = j; k < stride; k++)
+						gram [j * stride + k] += Array::SumMul (block.data() + j * n, block.data() + k * n, n);
+			}
+		});
+
+		// Collect the sums from all the threads
+		vector <double> gram (stride * stride, 0.0);
+		for (size_t t = 0; t < threads; t++)
+			for (size_t k = 0; k < stride * stride; k++)
+				gram[k] += partial [t * stride * stride + k];
+		return gram;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Centered copy of the predictors and the response                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> Centered (
+		const double x[],				// Predictors stored by columns
+		const vector <double> &means,	// Mean values of the columns
+		size_t threads					// Count of threads
+	) const {
+		const size_t size = values.Size();
+		const size_t stride = features + 1;
+		vector <double> basis (stride * size);
+		LeastSquares::Parallel (size, threads, [&] (size_t, size_t begin, size_t end) {
+			for (size_t k = 0; k < stride; k++) {
+				const double *column = k < features ? x + k * size : values.Data();
+				double *target = basis.data() + k * size;
+				for (size_t i = begin; i < end; i++)
+					target[i] = column[i] - means[k];
+			}
+		});
+		return basis;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Fit the regression to the dataset                                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Fit (
+		const double x[]				// Predictors stored by columns
+	){
+		const size_t size = values.Size();
+		const size_t threads = LeastSquares::Threads (size);
+		const vector <double> means = Means (x, threads);
+
+		// Factorize the centered columns by the selected solver
+		vector <double> unit, diag;
+		bool success;
+		if (solver == QR) {
+			vector <double> basis = Centered (x, means, threads);
+			success = LeastSquares::Orthogonalize (basis.data(), size, features, unit, diag);
+		}
+		else {
+			unit = Gram (x, means, threads);
+			success = LeastSquares::Factorize (unit, features, diag);
+		}
+		if (!success)
+			throw invalid_argument ("MultipleRegression: The predictors are linearly dependent");
+
+		// The slopes of the centered predictors and the intercept
+		double *c = coeffs.Data();
+		LeastSquares::Solve (unit, features, c + 1);
+		c[0] = means [features];
+		for (size_t k = 0; k < features; k++)
+			c[0] -= c[k+1] * means[k];
+
+		// Variances of the slopes are the diagonal of the inverse Gram matrix.
+		// The intercept is the mean response at the mean predictors, so its
+		// variance adds the variance of the slopes in the direction of means
+		const vector <double> inverse = LeastSquares::Inverse (unit, diag, features);
+		double *v = variances.Data();
+		v[0] = 1.0 / size;
+		for (size_t j = 0; j < features; j++) {
+			v[j+1] = inverse [j * features + j];
+			for (size_t k = 0; k < features; k++)
+				v[0] += means[j] * inverse [j * features + k] * means[k];
+		}
+
+		// Find the residuals and the sums of squares
+		vector <double> partial (2 * threads, 0.0);
+		double *r = residuals.Data();
+		LeastSquares::Parallel (size, threads, [&] (size_t t, size_t begin, size_t end) {
+			const double *y = values.Data();
+			for (size_t i = begin; i < end; i++)
+				r[i] = y[i] - means [features];
+			partial [2 * t] = Array::SumSqr (r + begin, end - begin);
+			for (size_t k = 0; k < features; k++) {
+				const double *column = x + k * size;
+				const double coeff = c[k+1];
+				const double mean = means[k];
+				for (size_t i = begin; i < end; i++)
+					r[i] -= coeff * (column[i] - mean);
+			}
+			partial [2 * t + 1] = Array::SumSqr (r + begin, end - begin);
+		});
+		total_ss = residual_ss = 0.0;
+		for (size_t t = 0; t < threads; t++) {
+			total_ss += partial [2 * t];
+			residual_ss += partial [2 * t + 1];
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Check the size of the predictors array                                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static const double* Check (
+		const vector <double> &x,		// Predictors stored by columns
+		size_t size,					// Size of the dataset
+		size_t features					// Count of the predictors
+	){
+		if (x.size() != size * features)
+			throw invalid_argument ("MultipleRegression: The predictors should have the same size as the response");
+		return x.data();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Join the columns of the predictors into a single array                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static vector <double> Columns (
+		const pylist &x,				// Columns of the predictors
+		size_t size						// Size of every column
+	){
+		vector <double> result;
+		const size_t features = len (x);
+		result.reserve (features * size);
+		for (size_t k = 0; k < features; k++) {
+			const vector <double> column = to_vector (extract <pylist> (x[k]));
+			if (column.size() != size)
+				throw invalid_argument ("MultipleRegression: The predictors should have the same size as the response");
+			result.insert (result.end(), column.begin(), column.end());
+		}
+		return result;
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructors                                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The predictors are stored by columns: the k-th predictor of the i-th
+//			observation is at the offset "k * size + i" of the array. They are
+//			read in place and are not stored in the object
+	MultipleRegression (
+		const double x[],				// Predictors stored by columns
+		const double y[],				// Response (dependent variables)
+		size_t size,					// Size of the dataset
+		size_t features,				// Count of the predictors
+		SolverType solver = CHOLESKY	// Least squares solver type
+	) :	solver (solver),
+		features (features),
+		values (y, size),
+		residuals (0.0, size),
+		coeffs (0.0, features + 1),
+		variances (0.0, features + 1)
+	{
+		// Check if the dataset is properly specified
+		if (!features)
+			throw invalid_argument ("MultipleRegression: There should be at least one predictor");
+		if (size <= features + 1)
+			throw invalid_argument ("MultipleRegression: The data size should be greater than the count of coefficients");
+
+		// Fit the regression to the dataset
+		Fit (x);
+	}
+
+	MultipleRegression (
+		const vector <double> &x,		// Predictors stored by columns
+		const vector <double> &y,		// Response (dependent variables)
+		size_t features,				// Count of the predictors
+		SolverType solver = CHOLESKY	// Least squares solver type
+	) :	MultipleRegression (Check (x, y.size(), features), y.data(), y.size(), features, solver)
+	{}
+
+	MultipleRegression (
+		const pylist &x,				// Columns of the predictors
+		const pylist &y,				// Response (dependent variables)
+		SolverType solver = CHOLESKY	// Least squares solver type
+	) : MultipleRegression (Columns (x, len (y)), to_vector (y), len (x), solver)
+	{}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Response (dependent variables)                                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> Y (void) const {
+		return values;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Regression approximation                                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> Approx (void) const {
+		return values - residuals;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Regression residuals                                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> Residuals (void) const {
+		return residuals;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Regression coefficients                                               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const vector <double> Coeffs (void) const {
+		return coeffs;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Standard errors of the regression coefficients                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const vector <double> StdErrCoeffs (void) const {
+		const double mse = MSE_RSS();
+		vector <double> errors (features + 1);
+		for (size_t j = 0; j <= features; j++)
+			errors[j] = sqrt (mse * variances[j]);
+		return errors;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Regression value for the target predictors                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double Regression (
+		const vector <double> &x		// Values of all the predictors
+	) const {
+		if (x.size() != features)
+			throw invalid_argument ("MultipleRegression: The count of the predictors is wrong");
+		double sum = coeffs[0];
+		for (size_t k = 0; k < features; k++)
+			sum += coeffs [k+1] * x[k];
+		return sum;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Regression values for the target predictors stored by columns         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> Regressions (
+		const vector <double> &x		// Predictors stored by columns
+	) const {
+		if (x.size() % features)
+			throw invalid_argument ("MultipleRegression: The count of the predictors is wrong");
+		const size_t size = x.size() / features;
+		vector <double> result (size, coeffs[0]);
+		for (size_t k = 0; k < features; k++)
+			Array::ScaledAdd (result.data(), x.data() + k * size, size, coeffs [k+1]);
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Total sum of squares (TSS)                                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double TSS (void) const {
+		return total_ss;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Residual sum of squares (RSS)                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double RSS (void) const {
+		return residual_ss;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Explained sum of squares (ESS)                                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double ESS (void) const {
+		return total_ss - residual_ss;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Mean square error (MSE) of total sum of squares (TSS)                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double MSE_TSS (void) const {
+		const size_t degrees_freedom = Size() - 1;
+		return TSS() / degrees_freedom;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Mean square error (MSE) of residual sum of squares (RSS)              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double MSE_RSS (void) const {
+		const size_t degrees_freedom = Size() - features - 1;
+		return RSS() / degrees_freedom;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Mean square error (MSE) of explained sum of squares (ESS)             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double MSE_ESS (void) const {
+		const size_t degrees_freedom = features;
+		return ESS() / degrees_freedom;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Fraction of variance explained                                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double ExplainedVarFrac (void) const {
+		return ESS() / TSS();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Fraction of variance unexplained                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double UnexplainedVarFrac (void) const {
+		return RSS() / TSS();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Coefficient of determination                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double Determination (void) const {
+		return ExplainedVarFrac();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Adjusted coefficient of determination                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double AdjustedDetermination (void) const {
+		return 1.0 - MSE_RSS() / MSE_TSS();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Coefficient of correlation                                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double Correlation (void) const {
+		return sqrt (ExplainedVarFrac());
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Standard error of the coefficient of correlation                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double StdErrCorrelation (void) const {
+		return UnexplainedVarFrac() / sqrt (Size() - features - 1);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Data size                                                             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Size (void) const {
+		return values.Size();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of the predictors                                               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Features (void) const {
+		return features;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Least squares solver type                                             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	SolverType Solver (void) const {
+		return solver;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Summary of the object                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	ObjectSummary Summary (
+		const string &name				// Object name
+	) const {
+
+		// Create the summary storage
+		ObjectSummary summary (name);
+
+		// Regression info
+		PropGroup info ("Regression info");
+		info.Append ("Data size", Size());
+		info.Append ("Predictors", Features());
+		info.Append ("Coefficient of determination", Determination());
+		info.Append ("Adjusted coefficient of determination", AdjustedDetermination());
+		info.Append ("Coefficient of correlation", Correlation());
+		info.Append ("Standard error of the correlation", StdErrCorrelation());
+		summary.Append (info);
+
+		// Model quality
+		PropGroup quality ("Model quality");
+		quality.Append ("Fraction of variance explained", ExplainedVarFrac());
+		quality.Append ("Fraction of variance unexplained", UnexplainedVarFrac());
+		summary.Append (quality);
+
+		// Sums of squares
+		PropGroup sums ("Sums of squares");
+		sums.Append ("Total sum of squares (TSS)", TSS());
+		sums.Append ("Explained sum of squares (ESS)", ESS());
+		sums.Append ("Residual sum of squares (RSS)", RSS());
+		sums.Append ("Mean square error (MSE) of TSS", MSE_TSS());
+		sums.Append ("Mean square error (MSE) of ESS", MSE_ESS());
+		sums.Append ("Mean square error (MSE) of RSS", MSE_RSS());
+		summary.Append (sums);
+
+		// Regression coefficients
+		PropGroup coefficients ("Regression coefficients");
+		const auto &coeffs = Coeffs();
+		for (size_t i = 0; i < coeffs.size(); i++) {
+			const string opt_name = string ("A[" + to_string (i) + "]");
+			coefficients.Append (opt_name, coeffs[i]);
+		}
+		summary.Append (coefficients);
+
+		// Standard errors of the regression coefficients
+		PropGroup coefficient_errors ("Standard errors of the coefficients");
+		const auto &errors = StdErrCoeffs();
+		for (size_t i = 0; i < errors.size(); i++) {
+			const string opt_name = string ("SE[" + to_string (i) + "]");
+			coefficient_errors.Append (opt_name, errors[i]);
+		}
+		summary.Append (coefficient_errors);
+
+		// Return the summary
+		return summary;
+	}
+};
+
+//****************************************************************************//
+//      Translate the object to a string                                      //
+//****************************************************************************//
+ostream& operator << (ostream &stream, const MultipleRegression &object)
+{
+	stream << object.Summary ("Multiple regression (MSE)");
+	return stream;
+}
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
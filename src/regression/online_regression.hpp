@@ -0,0 +1,524 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#         ONLINE REGRESSION BY ORTHOGONAL FUNCTIONS OVER A DATA STREAM         #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	"orthogonal_functions.hpp"
+# include	"../object_summary.hpp"
+# include	"../python_helpers.hpp"
+
+//****************************************************************************//
+//      Class "OnlineRegression"                                              //
+//****************************************************************************//
+// INFO:	The regression keeps the Gram matrix of the orthogonal functions
+//			and their dot products with the response values only, so adding
+//			and removing points costs O(count^2) operations and the memory
+//			does not depend on the data size. The coefficients are found by
+//			the same sequential projections that "OrthogonalRegression" does
+//			over the full vectors, so both give the same results when they
+//			share the mapping of X values to the orthogonality domain. The
+//			mapping is fixed at the construction, so the points outside the
+//			domain of X values are rejected rather than extrapolated
+class OnlineRegression
+{
+//============================================================================//
+//      Orthogonal functions type                                             //
+//============================================================================//
+public:
+	enum BasisType {
+		LEGENDRE,						// Legendre polynomials
+		TRIGONOMETRIC					// Trigonometric functions
+	};
+
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	BasisType basis;					// Orthogonal functions type
+	size_t degree;						// Regression degree
+	size_t count;						// Count of the orthogonal functions
+	Model::Range domain;				// Range of X values to accept
+	double center;						// Center point of the orthogonality domain
+	double variation;					// Half width of the orthogonality domain
+	vector <double> gram;				// Gram matrix of the orthogonal functions
+	vector <double> moments;			// Dot products of the functions and responses
+	vector <double> funcs;				// Buffer for the orthogonal functions values
+	double shift;						// Reference response value
+	double square;						// Sum of squares of the shifted responses
+	size_t size;						// Data size
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Check the argument range and map to the orthogonality domain          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double Convert (
+		double x						// X value to validate
+	) const {
+
+		// Outside the domain of X values
+		if (x != domain) {
+			const string &arg = to_string (x);
+			const string &min = to_string (domain.Min());
+			const string &max = to_string (domain.Max());
+			throw invalid_argument ("OnlineRegression: Argument value '" + arg + "' is outside the domain [" + min + ","+ max +"]");
+		}
+
+		// Map the argument to the orthogonality domain
+		return (x - center) / variation;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Values of all the orthogonal functions for the target X               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void FuncValues (
+		double x,						// Value to calculate the functions for
+		double values[]					// Values of the orthogonal functions
+	) const {
+
+		// Map the value to the orthogonality domain
+		const double arg = Convert (x);
+
+		// The first function is a constant for both of the function types
+		values[0] = 1.0;
+		switch (basis) {
+
+			// Legendre polynomials recurrence
+			case LEGENDRE:
+				values[1] = arg;
+				for (size_t j = 2; j < count; j++)
+					values[j] = (arg * values[j-1] * (2 * j - 1) - values[j-2] * (j - 1)) / j;
+				break;
+
+			// Sines and cosines by the angle addition formulas
+			case TRIGONOMETRIC: {
+				const double c1 = cos (M_PI * arg);
+				const double s1 = sin (M_PI * arg);
+				double c = 1.0, s = 0.0;
+				for (size_t j = 1; j <= degree; j++) {
+					const double temp = c * c1 - s * s1;
+					s = s * c1 + c * s1;
+					c = temp;
+					values[2 * j - 1] = c;
+					values[2 * j] = s;
+				}
+				break;
+			}
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Add or remove a point of the dataset                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Update (
+		double x,						// Predictor (independent variable)
+		double y,						// Response (dependent variable)
+		double sign						// +1 to add the point, -1 to remove it
+	){
+		// Check the argument before any statistics are changed
+		FuncValues (x, funcs.data());
+
+		// The first response value is the reference to reduce the cancellation
+		if (!size) shift = y;
+
+		// Update the upper triangle of the Gram matrix and the dot products
+		const double value = y - shift;
+		for (size_t i = 0; i < count; i++) {
+			const double temp = sign * funcs[i];
+			double *row = gram.data() + i * count;
+			for (size_t j = i; j < count; j++)
+				row[j] += temp * funcs[j];
+			moments[i] += temp * value;
+		}
+		square += sign * value * value;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Clear the accumulated statistics                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Clear (void) {
+		fill (gram.begin(), gram.end(), 0.0);
+		fill (moments.begin(), moments.end(), 0.0);
+		shift = 0.0;
+		square = 0.0;
+		size = 0;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Find the coefficients by the sequential projections                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The residuals before the j-th projection are the responses minus
+//			the previous terms, so their dot product with the j-th function
+//			is read from the Gram matrix. Each projection reduces the sum of
+//			squares of the residuals by c[j]^2 * |f[j]|^2
+	vector <double> Solve (
+		double &ess						// Explained sum of squares (ESS)
+	) const {
+
+		// Check if the statistics are enough to estimate the coefficients
+		if (size < count)
+			throw invalid_argument ("OnlineRegression: The data size should not be less than the count of orthogonal functions");
+
+		// Sequential projections of the residuals to the orthogonal functions
+		vector <double> coeffs (count);
+		ess = 0.0;
+		for (size_t j = 0; j < count; j++) {
+			double dot = moments[j];
+			for (size_t i = 0; i < j; i++)
+				dot -= coeffs[i] * gram [i * count + j];
+			const double norm2 = gram [j * count + j];
+			coeffs[j] = dot / norm2;
+			if (j) ess += coeffs[j] * coeffs[j] * norm2;
+		}
+
+		// Restore the constant term for the reference response value
+		coeffs[0] += shift;
+		return coeffs;
+	}
+
+//============================================================================//
+//      Public methods                                                        //
+//============================================================================//
+public:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Constructors                                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	OnlineRegression (
+		const Model::Range &domain,		// Range of X values to map to [-1..1]
+		size_t degree,					// Regression degree
+		BasisType basis					// Orthogonal functions type
+	) :	basis (basis),
+		degree (degree),
+		count (basis == LEGENDRE ? max (degree, size_t (1)) + 1 : 2 * degree + 1),
+		domain (domain),
+		center (0.5 * (domain.Min() + domain.Max())),
+		variation (0.5 * (domain.Max() - domain.Min())),
+		gram (count * count, 0.0),
+		moments (count, 0.0),
+		funcs (count, 0.0),
+		shift (0.0),
+		square (0.0),
+		size (0)
+	{
+		// Check if the domain is properly specified
+		if (!(variation > 0.0 && isfinite (variation)))
+			throw invalid_argument ("OnlineRegression: The domain of X values should have a finite nonzero width");
+	}
+
+	// Map the X values as "OrthogonalRegression" does for the initial dataset
+	OnlineRegression (
+		const vector <double> &x,		// Predictors (independent variables)
+		const vector <double> &y,		// Response (dependent variables)
+		size_t degree,					// Regression degree
+		BasisType basis					// Orthogonal functions type
+	) :	OnlineRegression (Model::Range (x), degree, basis)
+	{
+		// Use the mean value and the largest deviation from it for the mapping
+		const size_t n = min (x.size(), y.size());
+		const Model::Range range (x.data(), n);
+		domain = range;
+		center = Stats::Mean (x.data(), n);
+		variation = max (range.Max() - center, center - range.Min());
+
+		// Add the initial dataset
+		Add (x, y);
+	}
+
+	OnlineRegression (
+		const pylist &x,				// Predictors (independent variables)
+		const pylist &y,				// Response (dependent variables)
+		size_t degree,					// Regression degree
+		BasisType basis					// Orthogonal functions type
+	) : OnlineRegression (to_vector (x), to_vector (y), degree, basis)
+	{}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Add a point to the dataset                                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Add (
+		double x,						// Predictor (independent variable)
+		double y						// Response (dependent variable)
+	){
+		Update (x, y, 1.0);
+		size++;
+	}
+
+	void Add (
+		const vector <double> &x,		// Predictors (independent variables)
+		const vector <double> &y		// Response (dependent variables)
+	){
+		const size_t n = min (x.size(), y.size());
+		for (size_t i = 0; i < n; i++)
+			Add (x[i], y[i]);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Remove a point from the dataset                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The point should be added before. When the last point is removed,
+//			the statistics are cleared to drop the accumulated rounding errors
+	void Remove (
+		double x,						// Predictor (independent variable)
+		double y						// Response (dependent variable)
+	){
+		// Check if the dataset is not empty
+		if (!size)
+			throw invalid_argument ("OnlineRegression: There are no points to remove");
+
+		// Remove the point or clear the statistics
+		if (size > 1) {
+			Update (x, y, -1.0);
+			size--;
+		}
+		else {
+			Convert (x);
+			Clear();
+		}
+	}
+
+	void Remove (
+		const vector <double> &x,		// Predictors (independent variables)
+		const vector <double> &y		// Response (dependent variables)
+	){
+		const size_t n = min (x.size(), y.size());
+		for (size_t i = 0; i < n; i++)
+			Remove (x[i], y[i]);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Slide the data window: add a new point and remove the oldest one      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Slide (
+		double x,						// Predictor of the new point
+		double y,						// Response of the new point
+		double old_x,					// Predictor of the oldest point
+		double old_y					// Response of the oldest point
+	){
+		Add (x, y);
+		Remove (old_x, old_y);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Regression coefficients                                               //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const vector <double> Coeffs (void) const {
+		double ess;
+		return Solve (ess);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Standard errors of the regression coefficients                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const vector <double> StdErrCoeffs (void) const {
+		const double error = sqrt (MSE_RSS());
+		vector <double> errors (count);
+		for (size_t j = 0; j < count; j++)
+			errors[j] = error / sqrt (gram [j * count + j]);
+		return errors;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Regression value for the target argument                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double Regression (
+		double x						// Value to calculate the regression for
+	) const {
+		const vector <double> coeffs = Coeffs();
+		vector <double> values (count);
+		FuncValues (x, values.data());
+		double sum = 0.0;
+		for (size_t j = 0; j < count; j++)
+			sum += coeffs[j] * values[j];
+		return sum;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Total sum of squares (TSS)                                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double TSS (void) const {
+		return square - moments[0] * moments[0] / gram[0];
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Residual sum of squares (RSS)                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double RSS (void) const {
+		return TSS() - ESS();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Explained sum of squares (ESS)                                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double ESS (void) const {
+		double ess;
+		Solve (ess);
+		return ess;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Mean square error (MSE) of total sum of squares (TSS)                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double MSE_TSS (void) const {
+		const size_t degrees_freedom = size - 1;
+		return TSS() / degrees_freedom;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Mean square error (MSE) of residual sum of squares (RSS)              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double MSE_RSS (void) const {
+		const size_t degrees_freedom = size - count;
+		return RSS() / degrees_freedom;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Mean square error (MSE) of explained sum of squares (ESS)             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double MSE_ESS (void) const {
+		const size_t degrees_freedom = count - 1;
+		return ESS() / degrees_freedom;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Fraction of variance explained                                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double ExplainedVarFrac (void) const {
+		return ESS() / TSS();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Fraction of variance unexplained                                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double UnexplainedVarFrac (void) const {
+		return RSS() / TSS();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Coefficient of determination                                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double Determination (void) const {
+		return ExplainedVarFrac();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Coefficient of correlation                                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double Correlation (void) const {
+		return sqrt (ExplainedVarFrac());
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Standard error of the coefficient of correlation                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double StdErrCorrelation (void) const {
+		return UnexplainedVarFrac() / sqrt (size - count);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Range of X values the regression accepts                              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const Model::Range& Domain (void) const {
+		return domain;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Data size                                                             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Size (void) const {
+		return size;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Regression degree                                                     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Degree (void) const {
+		return degree;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of the orthogonal functions used                                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Functions (void) const {
+		return count;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Orthogonal functions type                                             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	BasisType Basis (void) const {
+		return basis;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Summary of the object                                                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	ObjectSummary Summary (
+		const string &name				// Object name
+	) const {
+
+		// Create the summary storage
+		ObjectSummary summary (name);
+
+		// Regression info
+		PropGroup info ("Regression info");
+		info.Append ("Data size", Size());
+		info.Append ("Regression degree", Degree());
+		info.Append ("Orthogonal functions", Functions());
+		info.Append ("Coefficient of determination", Determination());
+		info.Append ("Coefficient of correlation", Correlation());
+		info.Append ("Standard error of the correlation", StdErrCorrelation());
+		summary.Append (info);
+
+		// Sums of squares
+		PropGroup sums ("Sums of squares");
+		sums.Append ("Total sum of squares (TSS)", TSS());
+		sums.Append ("Explained sum of squares (ESS)", ESS());
+		sums.Append ("Residual sum of squares (RSS)", RSS());
+		sums.Append ("Mean square error (MSE) of RSS", MSE_RSS());
+		summary.Append (sums);
+
+		// Regression coefficients
+		PropGroup coefficients ("Regression coefficients");
+		const auto &coeffs = Coeffs();
+		for (size_t i = 0; i < coeffs.size(); i++) {
+			const string opt_name = string ("A[" + to_string (i) + "]");
+			coefficients.Append (opt_name, coeffs[i]);
+		}
+		summary.Append (coefficients);
+
+		// Standard errors of the regression coefficients
+		PropGroup coefficient_errors ("Standard errors of the coefficients");
+		const auto &errors = StdErrCoeffs();
+		for (size_t i = 0; i < errors.size(); i++) {
+			const string opt_name = string ("SE[" + to_string (i) + "]");
+			coefficient_errors.Append (opt_name, errors[i]);
+		}
+		summary.Append (coefficient_errors);
+
+		// Return the summary
+		return summary;
+	}
+};
+
+//****************************************************************************//
+//      Translate the object to a string                                      //
+//****************************************************************************//
+ostream& operator << (ostream &stream, const OnlineRegression &object)
+{
+	stream << object.Summary ("Online regression (MSE)");
+	return stream;
+}
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -13,6 +13,9 @@
 # include	"../templates/vector.hpp"
 # include	"../models/range.hpp"
 
+// Count of X values evaluated at once by the orthogonal expansion
+# define	ORTHOGONAL_BLOCK	256
+
 // Use shortenings
 using namespace std;
 using namespace Model;
@@ -35,6 +38,7 @@ protected:
 	double variation;		// Variation around the center of the original X values
 	size_t size;			// Number of the X values
 	size_t degree;			// Polynomial degree
+	size_t count;			// Number of the orthogonal functions
 
 //============================================================================//
 //      Private methods                                                       //
@@ -50,6 +54,23 @@ private:
 		return (x - center) / variation;
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Center point (weighted mean) of the X values                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double Center (
+		const double x[],		// X values to find the center of
+		const double w[],		// Weights of the X values (or NULL)
+		size_t size				// Number of the X values
+	){
+		if (!w) return Stats::Mean (x, size);
+		double sum = 0.0, total = 0.0;
+		for (size_t i = 0; i < size; i++) {
+			sum += w[i] * x[i];
+			total += w[i];
+		}
+		return sum / total;
+	}
+
 //============================================================================//
 //      Public methods                                                        //
 //============================================================================//
@@ -58,16 +79,21 @@ public:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Constructor                                                           //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The weighted X values are centered at their weighted mean, so the
+//			functions are the same as for the repeated X values
 	OrthogonalFunctions (
 		double x[],				// X values to map to the orthogonality domain
 		size_t size,			// Number of the X values
-		size_t degree			// Polynomial degree
+		size_t degree,			// Polynomial degree
+		size_t count,			// Number of the orthogonal functions
+		const double w[] = NULL	// Weights of the X values (or NULL)
 	) :	range (x, size),
 		values (x, size),
-		center (Stats::Mean (x, size)),
+		center (Center (x, w, size)),
 		variation (max (range.Max() - center, center - range.Min())),
 		size (size),
-		degree (degree)
+		degree (degree),
+		count (count)
 	{
 		// Check if the requirement for a minimum size is satisfied
 		if (size < 2)
@@ -106,6 +132,18 @@ public:
 		return Map (x);
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Check the arguments range and map them to the orthogonality domain    //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Convert (
+		const double x[],		// X values to validate
+		double args[],			// Mapped values
+		size_t size				// Number of the X values
+	) const {
+		for (size_t i = 0; i < size; i++)
+			args[i] = Convert (x[i]);
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Vector of the orthogonal functions in the set                         //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -117,7 +155,14 @@ public:
 //      Number of the orthogonal functions in the set                         //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	size_t Count (void) const {
-		return funcs.size();
+		return count;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Check if the orthogonal functions are not stored as full vectors      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool Lean (void) const {
+		return funcs.empty();
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -152,6 +197,28 @@ public:
 //      Virtual functions to override in derivative classes                   //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	virtual mvector FuncValues (double x) const = 0;
+
+	// Count of the first functions in the set which make up the expansion
+	// of the lower degree
+	virtual size_t CountFor (size_t degree) const = 0;
+
+	// Values of all the orthogonal functions for a block of X values (not
+	// greater than ORTHOGONAL_BLOCK). The values of the j-th function are
+	// stored at the offset "j * size" of the result array
+	virtual void FuncBlock (
+		const double x[],		// X values to calculate the functions for
+		double result[],		// Values of the orthogonal functions
+		size_t size				// Number of the X values
+	) const = 0;
+
+	// Orthogonal expansion with the coefficients for a block of X values
+	// (not greater than ORTHOGONAL_BLOCK) without any heap allocations
+	virtual void Expansion (
+		const double coeffs[],	// Coefficients of the expansion
+		const double x[],		// X values to calculate the expansion for
+		double result[],		// Values of the expansion
+		size_t size				// Number of the X values
+	) const = 0;
 };
 /*
 ################################################################################
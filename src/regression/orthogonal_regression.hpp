@@ -8,14 +8,64 @@
 ################################################################################
 */
 # pragma	once
+# include	<cstdint>
+# include	<cstring>
 # include	"orthogonal_functions.hpp"
+# include	"least_squares.hpp"
+# include	"../models/functions/beta.hpp"
+# include	"../observations/sample.hpp"
 # include	"../object_summary.hpp"
 
+// Tuning constant of the Huber loss function (95% efficiency for normal data)
+# define	ROBUST_HUBER_TUNING		1.345
+
+// Tuning constant of the Tukey bisquare loss function (95% efficiency)
+# define	ROBUST_BISQUARE_TUNING	4.685
+
+// Smallest scaled residual the least absolute deviations are weighted with
+# define	ROBUST_LAD_FLOOR		1e-6
+
+// Ratio of the median absolute deviation to the standard deviation
+# define	ROBUST_MAD_RATIO		0.67448975019608174320
+
+// Maximal count of the reweighting iterations
+# define	ROBUST_ITERATIONS		100
+
+// Relative change of the coefficients to stop the reweighting iterations
+# define	ROBUST_EPSILON			1e-10
+
+// Minimal size of the dataset to sort by the radix sort
+# define	RADIX_SORT_SIZE			4096
+
+// Count of the key bits every pass of the radix sort processes
+# define	RADIX_SORT_BITS			11
+
 //****************************************************************************//
 //      Class "OrthogonalRegression"                                          //
 //****************************************************************************//
 class OrthogonalRegression
 {
+//============================================================================//
+//      Criteria to select the regression degree                              //
+//============================================================================//
+public:
+	enum Criterion {
+		AIC,							// Akaike information criterion
+		BIC,							// Bayesian information criterion
+		GCV,							// Generalized cross-validation
+		FTEST							// F-test of every degree against the previous one
+	};
+
+//============================================================================//
+//      Loss functions of the regression                                      //
+//============================================================================//
+	enum LossFunction {
+		MSE,							// Mean square error (ordinary least squares)
+		HUBER,							// Huber loss
+		BISQUARE,						// Tukey bisquare (biweight) loss
+		LAD								// Least absolute deviations
+	};
+
 //============================================================================//
 //      Members                                                               //
 //============================================================================//
@@ -26,8 +76,15 @@ protected:
 	mvector approx;						// Regression approximation
 	mvector coeffs;						// Regression coefficients
 	mvector norms;						// Norms of orthogonal functions
+	mvector gains;						// Sums of squares every function explains
 	double total_ss;					// Total sum of squares (TSS)
 	double residual_ss;					// Residual sum of squares (RSS)
+	mvector priors;						// Prior weights of the observations (or empty)
+	double weight_sum;					// Total prior weight (data size if unweighted)
+	LossFunction loss;					// Loss function of the regression
+	mvector weights;					// Weights of the last reweighting pass
+	double scale;						// Robust scale of the residuals
+	size_t iterations;					// Count of the reweighting passes
 
 //============================================================================//
 //      Private methods                                                       //
@@ -40,7 +97,366 @@ private:
 	const mvector Deviation (
 		double scale					// Scale coefficient for the regression deviation
 	) const {
-		return mvector (sqrt (MSE_RSS()) * scale, funcs -> Size());
+		return mvector (Sigma() * scale, funcs -> Size());
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Standard deviation of the regression errors                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The outliers inflate the residual sum of squares, so the robust
+//			regression uses the robust scale of the residuals instead
+	double Sigma (void) const {
+		return loss == MSE ? sqrt (MSE_RSS()) : scale;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Regression approximation (restored from residuals for lean functions) //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const mvector Approximation (void) const {
+		return funcs -> Lean() ? values - residuals : approx;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Least squares coefficients from the factorized Gram matrix            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	void Solve (
+		const vector <double> &unit,	// Unit upper triangular matrix
+		const vector <double> &diag		// Squared norms of the orthogonalized functions
+	){
+		const size_t count = funcs -> Count();
+		const size_t stride = count + 1;
+		LeastSquares::Solve (unit, count, coeffs.Data());
+
+		// Variances of the coefficients are the diagonal of the inverse Gram
+		// matrix. The sums of squares come from the orthogonalized functions
+		const vector <double> inverse = LeastSquares::Inverse (unit, diag, count);
+		for (size_t j = 0; j < count; j++) {
+			const double proj = unit [j * stride + count];
+			norms[j] = 1.0 / sqrt (inverse [j * count + j]);
+			gains[j] = proj * proj * diag[j];
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Approximate the dataset with orthogonal functions block by block      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The functions are evaluated for a block of X values at once and
+//			accumulate their Gram matrix and dot products with the residuals.
+//			The sequential projections are then restored from these sums,
+//			so the coefficients are the same as with the stored functions,
+//			but the memory does not grow with the data size and the degree
+	void ApproximateBlocks (
+		bool exact						// Find the least squares coefficients
+	){
+		// Sums over all the blocks. The dot products are the last column
+		const size_t count = funcs -> Count();
+		const size_t stride = count + 1;
+		const size_t size = funcs -> Size();
+		const double *x = funcs -> Values().Data();
+		const double *r = residuals.Data();
+		vector <double> gram (stride * stride, 0.0);
+		vector <double> block (count * ORTHOGONAL_BLOCK);
+
+		// Accumulate the upper triangle of the Gram matrix and the dot products
+		for (size_t i = 0; i < size; i += ORTHOGONAL_BLOCK) {
+			const size_t n = min (size_t (ORTHOGONAL_BLOCK), size - i);
+			funcs -> FuncBlock (x + i, block.data(), n);
+			for (size_t j = 0; j < count; j++) {
+				const double *fj = block.data() + j * n;
+				for (size_t k = j; k < count; k++)
+					gram [j * stride + k] += Array::SumMul (fj, block.data() + k * n, n);
+				gram [j * stride + count] += Array::SumMul (fj, r + i, n);
+			}
+		}
+
+		ApproximateGram (gram, exact);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Approximate the dataset by the discrete orthogonalization             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The sampled functions are orthogonal on the uniform grid only. This
+//			method orthogonalizes copies of them on the actual X values, and
+//			the residuals are the last column of the orthogonalized basis
+	void ApproximateQR (void) {
+
+		// Copies of the functions and the residuals as the last column
+		const size_t count = funcs -> Count();
+		const size_t stride = count + 1;
+		const size_t size = funcs -> Size();
+		const vector <mvector> &functions = funcs -> Functions();
+		vector <double> basis (stride * size);
+		for (size_t j = 0; j < count; j++)
+			copy (functions[j].Data(), functions[j].Data() + size, basis.data() + j * size);
+		copy (residuals.Data(), residuals.Data() + size, basis.data() + count * size);
+
+		// Factorization of the functions
+		vector <double> unit, diag;
+		if (!LeastSquares::Orthogonalize (basis.data(), size, count, unit, diag))
+			throw invalid_argument ("OrthogonalRegression: The functions are linearly dependent on the dataset");
+		Solve (unit, diag);
+
+		// Update the residuals and the regression approximation
+		const double *column = basis.data() + count * size;
+		approx += residuals;
+		copy (column, column + size, residuals.Data());
+		approx -= residuals;
+
+		// Total sum of squares excludes the constant function only
+		total_ss = residual_ss = diag [count];
+		for (size_t k = 1; k < count; k++)
+			total_ss += gains[k];
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Weight of the residual for the loss function                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double Weight (
+		LossFunction loss,				// Loss function of the regression
+		double value					// Residual divided by the robust scale
+	){
+		const double dev = fabs (value);
+		switch (loss)
+		{
+			case HUBER:
+				return dev > ROBUST_HUBER_TUNING ? ROBUST_HUBER_TUNING / dev : 1.0;
+
+			case BISQUARE: {
+				if (dev >= ROBUST_BISQUARE_TUNING) return 0.0;
+				const double ratio = value / ROBUST_BISQUARE_TUNING;
+				const double weight = 1.0 - ratio * ratio;
+				return weight * weight;
+			}
+
+			case LAD:
+				return 1.0 / max (dev, ROBUST_LAD_FLOOR);
+
+			default:
+				return 1.0;
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Robust scale of the residuals                                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The median absolute deviation of the normal errors is the standard
+//			deviation multiplied by the ratio, so the scale is consistent with
+//			the standard deviation for the normal errors. The weighted residuals
+//			use the weighted median
+	double RobustScale (void) const {
+		if (priors.Size()) {
+			const Sample data (Residuals(), vector <double> (priors));
+			return data.MedianAbsDevFromMedian() / ROBUST_MAD_RATIO;
+		}
+		const Sample data (Residuals());
+		return data.MedianAbsDevFromMedian() / ROBUST_MAD_RATIO;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Residual sum of squares weighted by the prior weights                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double PriorRSS (void) const {
+		if (!priors.Size())
+			return residuals.NormSqr();
+		const double *r = residuals.Data();
+		const double *p = priors.Data();
+		double sum = 0.0;
+		for (size_t i = 0; i < residuals.Size(); i++)
+			sum += p[i] * r[i] * r[i];
+		return sum;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Weighted residual sum of squares of the last reweighting pass         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double WeightedRSS (void) const {
+		const double *r = residuals.Data();
+		const double *w = weights.Data();
+		double sum = 0.0;
+		for (size_t i = 0; i < residuals.Size(); i++)
+			sum += w[i] * r[i] * r[i];
+		return sum;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      One reweighting pass over the dataset block by block                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	Every block of the functions updates the residuals by the last
+//			change of the coefficients, weights them and accumulates the
+//			weighted Gram matrix of the functions and their weighted dot
+//			products with the residuals. So the functions are evaluated (or
+//			read from the memory) only once per iteration. The weights of the
+//			loss function are multiplied by the prior weights. The last pass
+//			only updates the residuals and returns the empty matrix
+	vector <double> Reweight (
+		const mvector &delta,			// Last change of the coefficients
+		size_t threads,					// Count of threads
+		LossFunction fit,				// Loss function to weigh the residuals by
+		bool weigh = true				// Find the weights and the Gram matrix
+	){
+		const size_t count = funcs -> Count();
+		const size_t stride = count + 1;
+		const size_t size = funcs -> Size();
+		const bool lean = funcs -> Lean();
+		const vector <mvector> &functions = funcs -> Functions();
+		const double *x = funcs -> Values().Data();
+		const double *c = delta.Data();
+		const double *p = priors.Size() ? priors.Data() : NULL;
+		double *r = residuals.Data();
+		double *w = weights.Data();
+		vector <double> partial (weigh ? threads * stride * stride : 0, 0.0);
+		LeastSquares::Parallel (size, threads, [&] (size_t t, size_t begin, size_t end) {
+			double *gram = partial.data() + t * stride * stride;
+			vector <double> block (lean ? count * ORTHOGONAL_BLOCK : 0);
+			vector <const double*> f (count);
+			alignas (SIMD_VSIZE) double temp [ORTHOGONAL_BLOCK];
+			for (size_t i = begin; i < end; i += ORTHOGONAL_BLOCK) {
+				const size_t n = min (size_t (ORTHOGONAL_BLOCK), end - i);
+
+				// Values of the functions for the block
+				if (lean)
+					funcs -> FuncBlock (x + i, block.data(), n);
+				for (size_t j = 0; j < count; j++)
+					f[j] = lean ? block.data() + j * n : functions[j].Data() + i;
+
+				// Residuals of the current coefficients
+				for (size_t j = 0; j < count; j++)
+					Array::ScaledSub (r + i, f[j], n, c[j]);
+				if (!weigh) continue;
+
+				// Weights of the residuals
+				for (size_t k = 0; k < n; k++)
+					w[i+k] = Weight (fit, r[i+k] / scale);
+				if (p)
+					for (size_t k = 0; k < n; k++)
+						w[i+k] *= p[i+k];
+
+				// Weighted dot products of the functions and the residuals
+				for (size_t j = 0; j < count; j++) {
+					for (size_t k = 0; k < n; k++)
+						temp[k] = w[i+k] * f[j][k];
+					for (size_t k = j; k < count; k++)
+						gram [j * stride + k] += Array::SumMul (temp, f[k], n);
+					gram [j * stride + count] += Array::SumMul (temp, r + i, n);
+				}
+			}
+		});
+
+		// Collect the sums from all the threads
+		vector <double> gram (weigh ? stride * stride : 0, 0.0);
+		for (size_t t = 0; t < threads && weigh; t++)
+			for (size_t k = 0; k < stride * stride; k++)
+				gram[k] += partial [t * stride * stride + k];
+		return gram;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Approximate the weighted dataset by the weighted least squares        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The functions are not orthogonal with the weights even on the
+//			uniform grid, so the weighted fit always finds the least squares
+//			coefficients. A single pass accumulates the weighted Gram matrix,
+//			and the next one finds the residuals. Integer weights give the
+//			same fit as the dataset with the observations repeated that many
+//			times. The Gram matrix squares the condition number of the
+//			functions, like the exact fitting of the lean functions
+	void ApproximateWeighted (void) {
+		const size_t count = funcs -> Count();
+		const size_t threads = LeastSquares::Threads (funcs -> Size());
+		const bool lean = funcs -> Lean();
+		if (!lean) approx += residuals;
+
+		// Factorize the weighted Gram matrix as U' * D * U in place
+		vector <double> gram = Reweight (coeffs, threads, MSE);
+		vector <double> diag;
+		if (!LeastSquares::Factorize (gram, count, diag))
+			throw invalid_argument ("OrthogonalRegression: The weighted functions are linearly dependent on the dataset");
+		Solve (gram, diag);
+
+		// Residuals of the coefficients and the sums of squares
+		Reweight (coeffs, threads, MSE, false);
+		if (!lean) approx -= residuals;
+		total_ss = residual_ss = PriorRSS();
+		for (size_t k = 1; k < count; k++)
+			total_ss += gains[k];
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Permutation which sorts the X values by the radix sort                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The bits of the X values are turned into the unsigned keys of the
+//			same order: negative values get all the bits flipped, the others
+//			get the sign bit set (negative zero is the positive one). The keys
+//			are sorted together with their indices digit by digit starting
+//			from the lowest one. Counts of
+//			all the digits are found in a single pass, and the digits which
+//			are the same for all the keys (like the high bits of time series)
+//			are skipped. The sort is stable and takes linear time
+	static vector <size_t> RadixPermutation (
+		const double x[],				// Predictors (independent variables)
+		size_t size						// Size of the dataset
+	){
+		const size_t buckets = size_t (1) << RADIX_SORT_BITS;
+		const size_t passes = (64 + RADIX_SORT_BITS - 1) / RADIX_SORT_BITS;
+		const uint64_t mask = buckets - 1;
+		const uint64_t sign = uint64_t (1) << 63;
+
+		// Sortable keys and the counts of their digits
+		vector <uint64_t> keys (size), temp_keys (size);
+		vector <size_t> index (size), temp_index (size);
+		vector <size_t> counts (passes * buckets, 0);
+		for (size_t i = 0; i < size; i++) {
+			uint64_t key;
+			memcpy (&key, x + i, sizeof (key));
+			if (key == sign) key = 0;
+			key = key & sign ? ~key : key | sign;
+			keys[i] = key;
+			index[i] = i;
+			for (size_t p = 0; p < passes; p++)
+				counts [p * buckets + ((key >> (p * RADIX_SORT_BITS)) & mask)]++;
+		}
+
+		// Distribute the keys by every digit
+		for (size_t p = 0; p < passes; p++) {
+			size_t *count = counts.data() + p * buckets;
+			const size_t shift = p * RADIX_SORT_BITS;
+
+			// Skip the digit if all the keys have the same value of it
+			if (count [(keys[0] >> shift) & mask] == size)
+				continue;
+
+			// Positions of the buckets
+			size_t position = 0;
+			for (size_t b = 0; b < buckets; b++) {
+				const size_t items = count[b];
+				count[b] = position;
+				position += items;
+			}
+
+			// Move the keys and their indices to the buckets
+			for (size_t i = 0; i < size; i++) {
+				const size_t target = count [(keys[i] >> shift) & mask]++;
+				temp_keys [target] = keys[i];
+				temp_index [target] = index[i];
+			}
+			keys.swap (temp_keys);
+			index.swap (temp_index);
+		}
+		return index;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Reorder the array by the permutation                                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static void Permute (
+		double data[],					// Array to reorder
+		const vector <size_t> &index,	// Permutation of the array
+		vector <double> &temp			// Temporary buffer of the array size
+	){
+		const size_t size = index.size();
+		for (size_t i = 0; i < size; i++)
+			temp[i] = data [index[i]];
+		copy (temp.begin(), temp.end(), data);
 	}
 
 //============================================================================//
@@ -49,27 +465,116 @@ private:
 protected:
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-//      Sort the data set (connected X and Y values) by X values              //
+//      Approximate the dataset by the Gram matrix of the functions           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The upper triangle of the Gram matrix holds the sums of products of
+//			the lean functions, and its last column holds their dot products
+//			with the residuals. The sequential projections are restored from
+//			these sums, and the exact fitting factorizes the Gram matrix
+//			instead. It squares the condition number of the functions, so the
+//			stored functions should be preferred for the badly conditioned
+//			datasets. The residuals are then updated block by block
+	void ApproximateGram (
+		vector <double> &gram,			// Gram matrix and the dot products
+		bool exact						// Find the least squares coefficients
+	){
+		const size_t count = funcs -> Count();
+		const size_t stride = count + 1;
+		const size_t size = funcs -> Size();
+		const double *x = funcs -> Values().Data();
+		double *r = residuals.Data();
+
+		// The first function is constant, so its coefficient is the mean value
+		const double mean = gram [count] / gram [0];
+
+		// Factorize the Gram matrix as U' * D * U in place
+		if (exact) {
+			vector <double> diag;
+			if (!LeastSquares::Factorize (gram, count, diag))
+				throw invalid_argument ("OrthogonalRegression: The functions are linearly dependent on the dataset");
+			Solve (gram, diag);
+		}
+
+		// Sequential projections of the residuals to the orthogonal functions
+		else {
+			for (size_t j = 0; j < count; j++) {
+				double dot = gram [j * stride + count];
+				for (size_t k = 0; k < j; k++)
+					dot -= coeffs[k] * gram [k * stride + j];
+				const double norm2 = gram [j * stride + j];
+				coeffs[j] = dot / norm2;
+				norms[j] = sqrt (norm2);
+				gains[j] = dot * dot / norm2;
+			}
+		}
+
+		// Update the residuals and find the sums of squares
+		alignas (SIMD_VSIZE) double temp [ORTHOGONAL_BLOCK];
+		const double *c = coeffs.Data();
+		total_ss = residual_ss = 0.0;
+		for (size_t i = 0; i < size; i += ORTHOGONAL_BLOCK) {
+			const size_t n = min (size_t (ORTHOGONAL_BLOCK), size - i);
+			funcs -> Expansion (c, x + i, temp, n);
+			for (size_t k = 0; k < n; k++) {
+				const double dev = r[i+k] - mean;
+				total_ss += dev * dev;
+				r[i+k] -= temp[k];
+			}
+			residual_ss += Array::SumSqr (r + i, n);
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Sort the data set (connected X, Y values and weights) by X values     //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The weights are checked here, before the functions are created.
+//			Sorted X values (like time series) are found by a single pass and
+//			are not moved at all. The caller may skip even this check if the
+//			X values are known to be sorted, but then unsorted values give a
+//			wrong regression. The sort is stable: the observations with the
+//			same X value keep their order
 	static double* Sort (
 		double x[],						// Predictors (independent variables)
 		double y[],						// Response (dependent variables)
-		size_t size						// Size of the dataset
+		double w[],						// Weights of the observations (or NULL)
+		size_t size,					// Size of the dataset
+		bool sorted = false				// X values are sorted in ascending order
 	){
-		// Prepare the connected variables for sorting
-		vector <pair <double, double> > pairs;
-		for (size_t i = 0; i < size; i++)
-			pairs.push_back (pair <double, double> (x[i], y[i]));
+		// Check if the weights are correct
+		if (w) {
+			double total = 0.0;
+			for (size_t i = 0; i < size; i++) {
+				if (!(w[i] >= 0.0 && isfinite (w[i])))
+					throw invalid_argument ("OrthogonalRegression: The weights must be non-negative finite numbers");
+				total += w[i];
+			}
+			if (!(total > 0.0))
+				throw invalid_argument ("OrthogonalRegression: The total weight must be positive");
+		}
 
-		// Sort them in ascending order
-		std::sort (pairs.begin(), pairs.end());
+		// Sorted predictors need no reordering
+		if (sorted || is_sorted (x, x + size))
+			return x;
 
-		// Put them back in the original arrays, but sorted
-		for (size_t i = 0; i < size; i++) {
-			x[i] = pairs[i].first;
-			y[i] = pairs[i].second;
+		// Permutation of the dataset which sorts the predictors
+		vector <size_t> index;
+		if (size >= RADIX_SORT_SIZE)
+			index = RadixPermutation (x, size);
+		else {
+			index.resize (size);
+			for (size_t i = 0; i < size; i++)
+				index[i] = i;
+			stable_sort (index.begin(), index.end(), [x] (size_t a, size_t b) {
+				return x[a] < x[b];
+			});
 		}
 
+		// Put the connected variables back in the original arrays, but sorted
+		vector <double> temp (size);
+		Permute (x, index, temp);
+		Permute (y, index, temp);
+		if (w) Permute (w, index, temp);
+
 		// Return sorted predictors back
 		return x;
 	}
@@ -79,14 +584,30 @@ protected:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	OrthogonalRegression (
 		double data[],						// Response values
-		const OrthogonalFunctions *funcs	// Orthogonal functions for the expansion
+		const OrthogonalFunctions *funcs,	// Orthogonal functions for the expansion
+		LossFunction loss = MSE,			// Loss function of the regression
+		const double priors[] = NULL		// Weights of the observations (or NULL)
 	) :	funcs (funcs),
 		values (data, funcs -> Size()),
 		residuals (data, funcs -> Size()),
-		approx (0.0, funcs -> Size()),
+		approx (0.0, funcs -> Lean() ? 0 : funcs -> Size()),
 		coeffs (0.0, funcs -> Count()),
-		norms (0.0, funcs -> Count())
-	{}
+		norms (0.0, funcs -> Count()),
+		gains (0.0, funcs -> Count()),
+		priors (priors, priors ? funcs -> Size() : 0),
+		weight_sum (funcs -> Size()),
+		loss (loss),
+		weights (1.0, loss == MSE && !priors ? 0 : funcs -> Size()),
+		scale (0.0),
+		iterations (0)
+	{
+		// Total weight of the observations
+		if (priors) {
+			weight_sum = 0.0;
+			for (size_t i = 0; i < funcs -> Size(); i++)
+				weight_sum += priors[i];
+		}
+	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Destructor                                                            //
@@ -98,7 +619,31 @@ protected:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Approximate the dataset with orthogonal functions                     //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
-	void Approximate (void) {
+// NOTE:	The sequential projections give the least squares coefficients only
+//			if the functions are orthogonal on the dataset, which is true for
+//			the uniform grid. Exact fitting orthogonalizes the functions on
+//			the actual X values and suits irregularly spaced datasets. The
+//			weighted datasets are always fitted exactly
+	void Approximate (
+		bool exact = false				// Find the least squares coefficients
+	){
+		// Weighted observations are fitted by the weighted least squares
+		if (priors.Size()) {
+			ApproximateWeighted();
+			return;
+		}
+
+		// Lean functions are evaluated block by block
+		if (funcs -> Lean()) {
+			ApproximateBlocks (exact);
+			return;
+		}
+
+		// Discrete orthogonalization of the stored functions
+		if (exact) {
+			ApproximateQR();
+			return;
+		}
 
 		// Get all of the orthogonal functions in the set
 		const vector <mvector> &functions = funcs -> Functions();
@@ -108,6 +653,7 @@ protected:
 		double coeff = functions[0].DotProduct (residuals) / norm2;
 		coeffs[0] = coeff;
 		norms[0] = sqrt (norm2);
+		gains[0] = coeff * coeff * norm2;
 
 		// Find residuals and regression approximation
 		const mvector &func0 = functions[0];
@@ -126,6 +672,7 @@ protected:
 			coeff = functions[j].DotProduct (residuals) / norm2;
 			coeffs[j] = coeff;
 			norms[j] = sqrt (norm2);
+			gains[j] = coeff * coeff * norm2;
 
 			// Find residuals and regression approximation
 			const mvector &func = functions[j];
@@ -137,6 +684,69 @@ protected:
 		residual_ss = residuals.NormSqr();
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Refit the approximation by the robust loss function                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	Iteratively reweighted least squares starting from the MSE fit. The
+//			scale of the residuals is their median absolute deviation. Every
+//			pass finds the residuals of the current coefficients and weighs
+//			them with the scale of the previous residuals, so the scale lags
+//			by one iteration and the pass stays single. The weighted Gram
+//			matrix gives the correction of the coefficients, and projections
+//			of the corrected fit go to the usual least squares solution, so
+//			the norms and the sums of squares the functions explain are the
+//			weighted ones. The weighted functions are not orthogonal, so the
+//			solution squares the condition number of the functions
+	void Robust (void) {
+		if (loss == MSE) return;
+
+		// Start from the MSE fit with the prior weights
+		const size_t count = funcs -> Count();
+		const size_t stride = count + 1;
+		const size_t threads = LeastSquares::Threads (funcs -> Size());
+		const bool lean = funcs -> Lean();
+		scale = RobustScale();
+		if (!lean) approx += residuals;
+
+		// Reweight the residuals until the coefficients stop changing
+		mvector delta (0.0, count);
+		for (iterations = 0; iterations < ROBUST_ITERATIONS && scale > 0.0;) {
+			vector <double> gram = Reweight (delta, threads, loss);
+			iterations++;
+
+			// Factorize the weighted Gram matrix as U' * D * U in place
+			vector <double> diag;
+			if (!LeastSquares::Factorize (gram, count, diag))
+				throw invalid_argument ("OrthogonalRegression: The weighted functions are linearly dependent on the dataset");
+
+			// Projections of the residuals plus the current fit
+			for (size_t j = 0; j < count; j++)
+				for (size_t k = j; k < count; k++)
+					gram [j * stride + count] += gram [j * stride + k] * coeffs[k];
+
+			// New coefficients and the scale of the current residuals
+			const mvector previous = coeffs;
+			Solve (gram, diag);
+			delta = coeffs - previous;
+			scale = RobustScale();
+
+			// Check the relative change of the coefficients
+			double change = 0.0, total = 0.0;
+			for (size_t j = 0; j < count; j++) {
+				change += fabs (delta[j]);
+				total += fabs (coeffs[j]);
+			}
+			if (change <= ROBUST_EPSILON * total)
+				break;
+		}
+
+		// Residuals of the final coefficients and the sums of squares
+		Reweight (delta, threads, loss, false);
+		scale = RobustScale();
+		residual_ss = PriorRSS();
+		if (!lean) approx -= residuals;
+	}
+
 //============================================================================//
 //      Public methods                                                        //
 //============================================================================//
@@ -167,7 +777,7 @@ public:
 //      Regression approximation                                              //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	vector <double> Approx (void) const {
-		return approx;
+		return Approximation();
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -183,7 +793,7 @@ public:
 	vector <double> ApproxMin (
 		double stdev					// Scale coefficient for standard deviation
 	) const {
-		return approx - Deviation (stdev);
+		return Approximation() - Deviation (stdev);
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -192,7 +802,7 @@ public:
 	vector <double> ApproxMax (
 		double stdev					// Scale coefficient for standard deviation
 	) const {
-		return approx + Deviation (stdev);
+		return Approximation() + Deviation (stdev);
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -205,8 +815,11 @@ public:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Standard errors of the regression coefficients                        //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The robust regression scales the inverse weighted Gram matrix by
+//			the robust scale. The least absolute deviations weigh the small
+//			residuals without a bound, so their errors are too optimistic
 	const vector <double> StdErrCoeffs (void) const {
-		mvector errors (sqrt (MSE_RSS()), funcs -> Count());
+		mvector errors (Sigma(), funcs -> Count());
 		return errors / norms;
 	}
 
@@ -216,7 +829,34 @@ public:
 	virtual double Regression (
 		double x						// Value to calculate the regression for
 	) const {
-		return funcs -> FuncValues (x).DotProduct (coeffs);
+		double result;
+		funcs -> Expansion (coeffs.Data(), &x, &result, 1);
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Regression values for the target arguments                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual void Regression (
+		const double x[],				// Values to calculate the regression for
+		double result[],				// Regression values
+		size_t size						// Number of the values
+	) const {
+
+		// Evaluate the orthogonal expansion block by block
+		const double *c = coeffs.Data();
+		for (size_t i = 0; i < size; i += ORTHOGONAL_BLOCK) {
+			const size_t count = min (size_t (ORTHOGONAL_BLOCK), size - i);
+			funcs -> Expansion (c, x + i, result + i, count);
+		}
+	}
+
+	vector <double> Regressions (
+		const vector <double> &x		// Values to calculate the regression for
+	) const {
+		vector <double> result (x.size());
+		Regression (x.data(), result.data(), x.size());
+		return result;
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -244,15 +884,17 @@ public:
 //      Mean square error (MSE) of total sum of squares (TSS)                 //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	double MSE_TSS (void) const {
-		const size_t degrees_freedom = funcs -> Size() - 1;
+		const double degrees_freedom = weight_sum - 1;
 		return TSS() / degrees_freedom;
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Mean square error (MSE) of residual sum of squares (RSS)              //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The weights are counts of the observations, so the degrees of
+//			freedom of the weighted regression come from the total weight
 	double MSE_RSS (void) const {
-		const size_t degrees_freedom = funcs -> Size() - funcs -> Count();
+		const double degrees_freedom = weight_sum - funcs -> Count();
 		return RSS() / degrees_freedom;
 	}
 
@@ -296,7 +938,7 @@ public:
 //      Standard error of the coefficient of correlation                      //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 	double StdErrCorrelation (void) const {
-		return UnexplainedVarFrac() / sqrt (funcs -> Size() - funcs -> Count());
+		return UnexplainedVarFrac() / sqrt (weight_sum - funcs -> Count());
 	}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -320,6 +962,217 @@ public:
 		return funcs -> Count();
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Loss function of the regression                                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	LossFunction Loss (void) const {
+		return loss;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Name of the loss function                                             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	string LossName (void) const {
+		switch (loss)
+		{
+			case HUBER:
+				return "Huber";
+
+			case BISQUARE:
+				return "Bisquare";
+
+			case LAD:
+				return "LAD";
+
+			default:
+				return "MSE";
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Robust scale of the residuals (zero for the MSE regression)           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double Scale (void) const {
+		return scale;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of the reweighting iterations (zero for the MSE regression)     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	size_t Iterations (void) const {
+		return iterations;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Weights of the observations in the regression                         //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The outliers get small weights (zero weights for the bisquare loss).
+//			These weights are multiplied by the prior weights, if any. The
+//			unweighted MSE regression weighs all the observations equally
+	vector <double> Weights (void) const {
+		if (!weights.Size())
+			return vector <double> (funcs -> Size(), 1.0);
+		return weights;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Prior weights of the observations (ones if unweighted)                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> PriorWeights (void) const {
+		if (!priors.Size())
+			return vector <double> (funcs -> Size(), 1.0);
+		return priors;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Total prior weight of the observations (data size if unweighted)      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	double TotalWeight (void) const {
+		return weight_sum;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Check if the observations have the prior weights                      //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	bool Weighted (void) const {
+		return priors.Size() != 0;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Residual sums of squares for all the degrees up to the set one        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	Every function removes its own sum of squares from the residuals,
+//			so the regression of a lower degree leaves the sums of squares of
+//			the dropped functions unexplained. The whole path comes from the
+//			single fit without any refitting. The trigonometric regression
+//			keeps the connection line of the set degree for all the degrees.
+//			The robust regression sums the squares with the weights of its
+//			last reweighting pass
+	vector <double> RSSPath (void) const {
+		const size_t degree = funcs -> Degree();
+		vector <double> result (degree + 1);
+		double rss = loss == MSE ? residual_ss : WeightedRSS();
+		size_t count = funcs -> Count();
+		for (size_t d = degree + 1; d-- > 0;) {
+			const size_t used = funcs -> CountFor (d);
+			while (count > used)
+				rss += gains [--count];
+			result[d] = rss;
+		}
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Akaike information criterion (AIC) for all the degrees                //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> AICPath (void) const {
+		const double n = weight_sum;
+		vector <double> result = RSSPath();
+		for (size_t d = 0; d < result.size(); d++)
+			result[d] = n * log (result[d] / n) + 2.0 * funcs -> CountFor (d);
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Bayesian information criterion (BIC) for all the degrees              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> BICPath (void) const {
+		const double n = weight_sum;
+		vector <double> result = RSSPath();
+		for (size_t d = 0; d < result.size(); d++)
+			result[d] = n * log (result[d] / n) + log (n) * funcs -> CountFor (d);
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Generalized cross-validation (GCV) score for all the degrees          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> GCVPath (void) const {
+		const double n = weight_sum;
+		vector <double> result = RSSPath();
+		for (size_t d = 0; d < result.size(); d++) {
+			const double df = n - funcs -> CountFor (d);
+			result[d] = df > 0.0 ? n * result[d] / (df * df) : INFINITY;
+		}
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      F statistics of every degree against the previous one                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The zero degree has nothing to compare with and gets NAN. So does
+//			the degree which adds no functions to the previous one
+	vector <double> FPath (void) const {
+		const double n = weight_sum;
+		const vector <double> rss = RSSPath();
+		vector <double> result (rss.size(), NAN);
+		for (size_t d = 1; d < rss.size(); d++) {
+			const double df1 = funcs -> CountFor (d) - funcs -> CountFor (d - 1);
+			const double df2 = n - funcs -> CountFor (d);
+			if (df1 > 0.0 && df2 > 0.0)
+				result[d] = ((rss[d-1] - rss[d]) / df1) / (rss[d] / df2);
+		}
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      P-values of the F-test of every degree against the previous one       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	vector <double> PValuePath (void) const {
+		const double n = weight_sum;
+		vector <double> result = FPath();
+		for (size_t d = 1; d < result.size(); d++) {
+			const double f = result[d];
+			if (isnan (f)) continue;
+			const double df1 = funcs -> CountFor (d) - funcs -> CountFor (d - 1);
+			const double df2 = n - funcs -> CountFor (d);
+
+			// The upper tail of the F-distribution
+			const Model::SpecialBeta beta (0.5 * df2, 0.5 * df1);
+			result[d] = f > 0.0 ? beta.RegIncompleteBeta (df2 / (df2 + df1 * f)) : 1.0;
+		}
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      The best regression degree by the criterion                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The information criteria and GCV take the degree of the smallest
+//			score. The F-test takes the highest degree which is significant
+//			against the previous one at the given level
+	size_t BestDegree (
+		Criterion criterion,			// Criterion to select the degree
+		double alpha = 0.05				// Significance level of the F-test
+	) const {
+		vector <double> path;
+		switch (criterion)
+		{
+			case AIC:
+				path = AICPath();
+				break;
+
+			case BIC:
+				path = BICPath();
+				break;
+
+			case GCV:
+				path = GCVPath();
+				break;
+
+			case FTEST: {
+				path = PValuePath();
+				size_t best = 0;
+				for (size_t d = 1; d < path.size(); d++)
+					if (path[d] < alpha) best = d;
+				return best;
+			}
+
+			default:
+				throw invalid_argument ("OrthogonalRegression: Unknown criterion to select the degree");
+		}
+		return min_element (path.begin(), path.end()) - path.begin();
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Summary of the object                                                 //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -333,8 +1186,14 @@ public:
 		// Regression info
 		PropGroup info ("Regression info");
 		info.Append ("Data size", Size());
+		if (Weighted())
+			info.Append ("Total weight", TotalWeight());
 		info.Append ("Regression degree", Degree());
 		info.Append ("Orthogonal functions", Functions());
+		if (loss != MSE) {
+			info.Append ("Robust scale of the residuals", Scale());
+			info.Append ("Reweighting iterations", Iterations());
+		}
 		info.Append ("Coefficient of determination", Determination());
 		info.Append ("Coefficient of correlation", Correlation());
 		info.Append ("Standard error of the correlation", StdErrCorrelation());
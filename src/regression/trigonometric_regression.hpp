@@ -8,14 +8,222 @@
 ################################################################################
 */
 # pragma	once
+# include	<complex>
 # include	"orthogonal_regression.hpp"
+# include	"../templates/fft.hpp"
 # include	"../python_helpers.hpp"
 
+// Maximal phase shift of the highest harmonic for the X values which are
+// treated as the uniform grid
+# define	TRIGONOMETRIC_UNIFORM_PHASE	1e-12
+
+// Half width of the Gaussian kernel (in the grid steps) for the gridding.
+// It gives about 12 correct digits of the Fourier moments
+# define	TRIGONOMETRIC_GRIDDING_WIDTH	12
+
+// Minimal degree to choose the fast Fourier transform on the uniform grid
+# define	TRIGONOMETRIC_UNIFORM_DEGREE	4
+
+// Minimal degree to choose the gridding to the uniform grid
+# define	TRIGONOMETRIC_GRIDDING_DEGREE	8
+
 //****************************************************************************//
 //      Class "TrigonometricFunctions"                                        //
 //****************************************************************************//
 class TrigonometricFunctions : public OrthogonalFunctions
 {
+//============================================================================//
+//      Methods to find the sums over the X values                            //
+//============================================================================//
+public:
+	enum FourierMethod {
+		AUTO,					// Choose the fastest method for the X values
+		DIRECT,					// Evaluate the functions for every X value
+		UNIFORM,				// Fast Fourier transform of the uniform grid
+		GRIDDING				// Gaussian gridding to the uniform grid
+	};
+
+//============================================================================//
+//      Members                                                               //
+//============================================================================//
+private:
+	FourierMethod method;		// Method to find the sums over the X values
+
+//============================================================================//
+//      Private methods                                                       //
+//============================================================================//
+private:
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Maximal deviation of the mapped X values from the uniform grid        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	static double Deviation (
+		const double x[],		// Mapped X values
+		size_t size				// Number of the X values
+	){
+		const double step = 2.0 / (size - 1);
+		double result = 0.0;
+		for (size_t i = 0; i < size; i++)
+			result = max (result, fabs (x[i] - (i * step - 1.0)));
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Choose the method to find the sums over the X values                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The uniform grid must match the mapped X values up to a tiny phase
+//			shift of the highest harmonic. The automatic choice takes the FFT
+//			of the uniform grid only if its period is the power of two. The
+//			Bluestein transform of the other sizes takes three transforms of
+//			the doubled size, so the gridding is faster for them. It is taken
+//			for the X values which stay within a grid step of the uniform
+//			grid. Both need the degree high enough to pay off
+	FourierMethod Choose (
+		const double x[],		// Mapped X values
+		const double w[],		// Weights of the X values (or NULL)
+		FourierMethod method	// Requested method
+	) const {
+		if (method == DIRECT)
+			return DIRECT;
+
+		// The Fourier methods sum the X values with equal weights
+		if (w) {
+			if (method == AUTO) return DIRECT;
+			throw invalid_argument ("TrigonometricFunctions: The Fourier methods do not support the weighted X values");
+		}
+
+		// The highest sine vanishes on the uniform grid of the same count
+		if (count >= size) {
+			if (method == AUTO) return DIRECT;
+			throw invalid_argument ("TrigonometricFunctions: The Fourier methods need more X values than the functions");
+		}
+
+		// Phase shift of the highest harmonic if the grid is uniform
+		const double deviation = Deviation (x, size);
+		const bool uniform = M_PI * degree * deviation <= TRIGONOMETRIC_UNIFORM_PHASE;
+		switch (method)
+		{
+			case UNIFORM:
+				if (!uniform)
+					throw invalid_argument ("TrigonometricFunctions: The X values are not uniformly spaced");
+				return UNIFORM;
+
+			case GRIDDING:
+				return GRIDDING;
+
+			default:
+				if (uniform && degree >= TRIGONOMETRIC_UNIFORM_DEGREE && FFT::PowerOfTwo (size - 1) == size - 1)
+					return UNIFORM;
+				if (deviation * (size - 1) <= 2.0 && degree >= TRIGONOMETRIC_GRIDDING_DEGREE)
+					return GRIDDING;
+				return DIRECT;
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Fourier moments of the data on the uniform grid                       //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The mapped X values are "-1 + 2 * k / M", where "M = size - 1", so
+//			"exp (I * pi * n * x)" is "(-1)^n * exp (2 * pi * I * n * k / M)".
+//			The last X value is the first one shifted by the period, so its
+//			value is added to the first one, and the moments are the inverse
+//			transform of the length M. The constant data have the moments in
+//			closed form
+	vector <complex <double>> UniformMoments (
+		const double data[],	// Data at the X values (or NULL for ones)
+		size_t count			// Count of the moments
+	) const {
+		const size_t period = size - 1;
+		vector <complex <double>> result (count);
+
+		// Moments of the constant data
+		if (!data) {
+			for (size_t n = 0; n < count; n++) {
+				const double sum = n % period ? 1.0 : period + 1.0;
+				result[n] = n & 1 ? -sum : sum;
+			}
+			return result;
+		}
+
+		// Moments of the data
+		vector <complex <double>> spectrum (data, data + period);
+		spectrum[0] += data [period];
+		FFT::DFT (spectrum, true);
+		for (size_t n = 0; n < count; n++) {
+			const complex <double> &sum = spectrum [n % period];
+			result[n] = n & 1 ? -sum : sum;
+		}
+		return result;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Fourier moments of the data by the Gaussian gridding                  //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The data are spread to the oversampled uniform grid of the angles
+//			by the Gaussian kernel, and the grid is transformed by the FFT.
+//			The grid size is the power of two, so the indices wrap by a mask.
+//			The moments of the kernel are known in closed form, so the result
+//			is divided by them. The kernel is the product of three exponents
+//			for the grid points around the angle of every X value, and only
+//			two of them depend on the X value. The angles are shifted by "pi"
+//			to the range [0, 2 * pi], which flips the signs of the odd moments
+	vector <complex <double>> GriddingMoments (
+		const double data[],	// Data at the X values (or NULL for ones)
+		size_t count			// Count of the moments
+	) const {
+		const long width = TRIGONOMETRIC_GRIDDING_WIDTH;
+		const size_t grid = FFT::PowerOfTwo (2 * (2 * count - 1));
+		const size_t mask = grid - 1;
+		const double modes = grid / 2;
+		const double tau = M_PI * width / (3.0 * modes * modes);
+		const double step = 2.0 * M_PI / grid;
+
+		// The kernel factors which do not depend on the X values
+		vector <double> kernel (width + 1);
+		for (long l = 0; l <= width; l++)
+			kernel[l] = exp (-(l * step) * (l * step) / (4.0 * tau));
+
+		// Spread the data to the grid
+		const double *x = values.Data();
+		vector <complex <double>> spread (grid);
+		alignas (SIMD_VSIZE) double args [ORTHOGONAL_BLOCK];
+		for (size_t i = 0; i < size; i += ORTHOGONAL_BLOCK) {
+			const size_t n = min (size_t (ORTHOGONAL_BLOCK), size - i);
+			Convert (x + i, args, n);
+			for (size_t k = 0; k < n; k++) {
+				const double angle = M_PI * (args[k] + 1.0);
+				const long node = long (angle / step);
+				const double delta = angle - node * step;
+				const double value = (data ? data [i + k] : 1.0) * exp (-delta * delta / (4.0 * tau));
+				const double factor = exp (delta * step / (2.0 * tau));
+
+				// Grid points at and after the angle
+				double power = value;
+				for (long l = 0; l <= width; l++) {
+					spread [size_t (node + l) & mask] += power * kernel[l];
+					power *= factor;
+				}
+
+				// Grid points before the angle
+				power = value / factor;
+				for (long l = 1; l <= width; l++) {
+					spread [size_t (node - l) & mask] += power * kernel[l];
+					power /= factor;
+				}
+			}
+		}
+
+		// Transform the grid and divide it by the moments of the kernel
+		FFT::Transform (spread, true);
+		vector <complex <double>> result (count);
+		const double scale = sqrt (M_PI / tau) / grid;
+		for (size_t n = 0; n < count; n++) {
+			const complex <double> sum = spread[n] * (scale * exp (tau * n * n));
+			result[n] = n & 1 ? -sum : sum;
+		}
+		return result;
+	}
+
 //============================================================================//
 //      Public methods                                                        //
 //============================================================================//
@@ -24,32 +232,94 @@ public:
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Constructor                                                           //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	Lean functions are not stored as full vectors. They are evaluated
+//			block by block on every use instead. The Fourier methods do not
+//			need the functions at all, so they are always lean
 	TrigonometricFunctions (
 		double x[],				// X values
 		size_t size,			// Number of the X values
-		size_t degree			// Polynomial degree
-	) : OrthogonalFunctions (x, size, degree)
+		size_t degree,			// Polynomial degree
+		bool lean = false,		// Do not store the functions
+		const double w[] = NULL,	// Weights of the X values (or NULL)
+		FourierMethod method = DIRECT	// Method to find the sums over the X values
+	) : OrthogonalFunctions (x, size, degree, 2 * degree + 1, w)
 	{
 		// Check if the degree is properly specified
 		if (2 * degree > size)
 			throw invalid_argument ("TrigonometricFunctions: The degree should not be greater than half of the data size");
 
+		// Choose the method by the mapped X values
+		this -> method = Choose (x, w, method);
+
+		// Lean functions are evaluated on demand
+		if (lean || this -> method != DIRECT) return;
+
 		// The first function is an average value
 		funcs.push_back (mvector (1.0, size));
 
 		// Compute sines and cosines for different multiplicity factors
-		alignas (SIMD_VSIZE) double cos_vals [size];
-		alignas (SIMD_VSIZE) double sin_vals [size];
 		for (size_t j = 1; j <= degree; j++) {
+			mvector cos_func (size);
+			mvector sin_func (size);
+			double *cos_vals = cos_func.Data();
+			double *sin_vals = sin_func.Data();
 			for (size_t i = 0; i < size; i++) {
 				cos_vals[i] = cos (M_PI * j * x[i]);
 				sin_vals[i] = sin (M_PI * j * x[i]);
 			}
-			funcs.push_back (mvector (cos_vals, size));
-			funcs.push_back (mvector (sin_vals, size));
+			funcs.push_back (cos_func);
+			funcs.push_back (sin_func);
 		}
 	}
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Method to find the sums over the X values                             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	FourierMethod Method (void) const {
+		return method;
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Fourier moments of the data for the multiplicity factors              //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The moment "n" is the sum of "data[k] * exp (I * pi * n * x[k])"
+//			over the mapped X values, so its real and imaginary parts are
+//			the dot products of the data with the cosine and sine functions.
+//			The direct method evaluates the sums for every X value
+	vector <complex <double>> Moments (
+		const double data[],	// Data at the X values (or NULL for ones)
+		size_t count			// Count of the moments
+	) const {
+		switch (method)
+		{
+			case UNIFORM:
+				return UniformMoments (data, count);
+
+			case GRIDDING:
+				return GriddingMoments (data, count);
+
+			default:
+				vector <complex <double>> result (count);
+				const double *x = values.Data();
+				for (size_t i = 0; i < size; i++) {
+					const double arg = Convert (x[i]);
+					const double value = data ? data[i] : 1.0;
+					for (size_t n = 0; n < count; n++)
+						result[n] += value * polar (1.0, M_PI * n * arg);
+				}
+				return result;
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Count of the functions for the lower degree                           //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual size_t CountFor (
+		size_t degree			// Polynomial degree not greater than the set one
+	) const override final {
+		return 2 * degree + 1;
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Calculate values of all the trigonometric functions for the target X  //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -73,6 +343,77 @@ public:
 		// Return the values
 		return vals;
 	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Values of all the trigonometric functions for a block of X values     //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual void FuncBlock (
+		const double x[],		// X values to calculate the functions for
+		double result[],		// Values of the orthogonal functions
+		size_t size				// Number of the X values
+	) const override final {
+
+		// Check the arguments range and map them to the orthogonality domain
+		alignas (SIMD_VSIZE) double args [ORTHOGONAL_BLOCK];
+		Convert (x, args, size);
+
+		// The first function is an average value
+		fill (result, result + size, 1.0);
+
+		// Compute sines and cosines for different multiplicity factors
+		for (size_t j = 1; j <= degree; j++) {
+			double *cos_vals = result + (2 * j - 1) * size;
+			double *sin_vals = result + 2 * j * size;
+			for (size_t i = 0; i < size; i++) {
+				cos_vals[i] = cos (M_PI * j * args[i]);
+				sin_vals[i] = sin (M_PI * j * args[i]);
+			}
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Orthogonal expansion for a block of X values                          //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	Only the first cosine and sine are computed directly. The next
+//			multiplicity factors are found by the angle addition formulas,
+//			so the expansion costs two trigonometric calls per X value
+	virtual void Expansion (
+		const double coeffs[],	// Coefficients of the expansion
+		const double x[],		// X values to calculate the expansion for
+		double result[],		// Values of the expansion
+		size_t size				// Number of the X values
+	) const override final {
+
+		// Check the arguments range and map them to the orthogonality domain
+		alignas (SIMD_VSIZE) double args [ORTHOGONAL_BLOCK];
+		Convert (x, args, size);
+
+		// Sines and cosines of the base angle and of its multiples
+		alignas (SIMD_VSIZE) double cos1 [ORTHOGONAL_BLOCK];
+		alignas (SIMD_VSIZE) double sin1 [ORTHOGONAL_BLOCK];
+		alignas (SIMD_VSIZE) double cos_vals [ORTHOGONAL_BLOCK];
+		alignas (SIMD_VSIZE) double sin_vals [ORTHOGONAL_BLOCK];
+		for (size_t i = 0; i < size; i++) {
+			cos1[i] = cos_vals[i] = cos (M_PI * args[i]);
+			sin1[i] = sin_vals[i] = sin (M_PI * args[i]);
+		}
+
+		// The first function is an average value
+		fill (result, result + size, coeffs[0]);
+
+		// Add sines and cosines for different multiplicity factors
+		for (size_t j = 1; j <= degree; j++) {
+			const double a = coeffs[2 * j - 1];
+			const double b = coeffs[2 * j];
+			for (size_t i = 0; i < size; i++) {
+				result[i] += a * cos_vals[i] + b * sin_vals[i];
+				const double c = cos_vals[i] * cos1[i] - sin_vals[i] * sin1[i];
+				const double s = sin_vals[i] * cos1[i] + cos_vals[i] * sin1[i];
+				cos_vals[i] = c;
+				sin_vals[i] = s;
+			}
+		}
+	}
 };
 
 //****************************************************************************//
@@ -86,20 +427,108 @@ class TrigonometricRegression : public OrthogonalRegression
 private:
 	double coeff;				// Coefficient for the linear correction
 
+//============================================================================//
+//      Methods to find the sums over the X values                            //
+//============================================================================//
+public:
+	typedef TrigonometricFunctions::FourierMethod FourierMethod;
+
 //============================================================================//
 //      Private methods                                                       //
 //============================================================================//
 private:
 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Mean value of the connection points                                   //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The points of zero total weight take the usual mean value
+	static double Mean (
+		const double data[],	// Values of the connection points
+		const double w[],		// Weights of the points (or NULL)
+		size_t size				// Count of the points
+	){
+		double sum = 0.0, total = 0.0;
+		for (size_t i = 0; w && i < size; i++) {
+			sum += w[i] * data[i];
+			total += w[i];
+		}
+		return total > 0.0 ? sum / total : Stats::Mean (data, size);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Trigonometric functions of the regression                             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	const TrigonometricFunctions* Basis (void) const {
+		return static_cast <const TrigonometricFunctions*> (funcs);
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Approximate the dataset by the Fourier moments                        //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// INFO:	The products of the cosines and sines are the halved sums and
+//			differences of the functions of the summed and subtracted
+//			multiplicity factors. So the Gram matrix comes from the moments
+//			of ones up to the doubled degree, and the dot products with the
+//			residuals are their moments up to the degree. Both take a single
+//			FFT instead of evaluating all the functions for every X value
+	void ApproximateFourier (
+		bool exact				// Find the least squares coefficients
+	){
+		const TrigonometricFunctions *trig = Basis();
+		const size_t degree = trig -> Degree();
+		const size_t count = trig -> Count();
+		const size_t stride = count + 1;
+		const vector <complex <double>> ones = trig -> Moments (NULL, 2 * degree + 1);
+		const vector <complex <double>> dots = trig -> Moments (residuals.Data(), degree + 1);
+
+		// Sums of the cosines and sines of the multiplicity factor
+		auto cosine = [&ones] (long n) {
+			return ones [labs (n)].real();
+		};
+		auto sine = [&ones] (long n) {
+			return n < 0 ? -ones [-n].imag() : ones [n].imag();
+		};
+
+		// Upper triangle of the Gram matrix and the dot products. The odd
+		// functions are cosines and the even ones (except the first) are sines
+		vector <double> gram (stride * stride, 0.0);
+		for (size_t j = 0; j < count; j++) {
+			const long a = (j + 1) / 2;
+			const bool sin_a = j && !(j & 1);
+			for (size_t k = j; k < count; k++) {
+				const long b = (k + 1) / 2;
+				const bool sin_b = k && !(k & 1);
+				double sum;
+				if (sin_a)
+					sum = sin_b ? cosine (a - b) - cosine (a + b) : sine (a + b) + sine (a - b);
+				else
+					sum = sin_b ? sine (a + b) - sine (a - b) : cosine (a - b) + cosine (a + b);
+				gram [j * stride + k] = 0.5 * sum;
+			}
+			gram [j * stride + count] = sin_a ? dots[a].imag() : dots[a].real();
+		}
+		ApproximateGram (gram, exact);
+	}
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 //      Internal constructor                                                  //
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// NOTE:	The reweighting of the robust loss is not supported by the Fourier
+//			methods, so the automatic choice takes the direct method for it.
+//			A forced Fourier method finds the first fit only, and then the
+//			reweighting passes evaluate the lean functions block by block
 	TrigonometricRegression (
 		double x[],				// Predictors (independent variables)
 		double y[],				// Response (dependent variables)
+		double w[],				// Weights of the observations (or NULL)
 		size_t size,			// Size of the dataset
-		size_t degree			// Polynomial degree
-	) :	OrthogonalRegression (y, new TrigonometricFunctions (Sort (x, y, size), size, degree))
+		size_t degree,			// Polynomial degree
+		bool lean,				// Do not store the functions
+		bool exact,				// Find the least squares coefficients
+		LossFunction loss,		// Loss function of the regression
+		bool sorted,			// X values are sorted in ascending order
+		FourierMethod method	// Method to find the sums over the X values
+	) :	OrthogonalRegression (y, new TrigonometricFunctions (Sort (x, y, w, size, sorted), size, degree, lean, w, loss == MSE || method != TrigonometricFunctions::AUTO ? method : TrigonometricFunctions::DIRECT), loss, w)
 	{
 		// Calculate the number of connection points to connect
 		// the left and right sides of the dataset smoothly
@@ -107,12 +536,13 @@ private:
 		if (!points) points = 1;
 
 		// Get the left point for smooth connection
-		const double left_x = Stats::Mean (x, points);
-		const double left_y = Stats::Mean (y, points);
+		const double left_x = Mean (x, w, points);
+		const double left_y = Mean (y, w, points);
 
 		// Get the right point for smooth connection
-		const double right_x = Stats::Mean (x + size - points, points);
-		const double right_y = Stats::Mean (y + size - points, points);
+		const size_t right = size - points;
+		const double right_x = Mean (x + right, w ? w + right : w, points);
+		const double right_y = Mean (y + right, w ? w + right : w, points);
 
 		// Calculate the connection line
 		const double p = right_y - left_y;
@@ -126,10 +556,16 @@ private:
 		residuals -= trend_line;
 
 		// Approximate the dependent variables by the regression
-		Approximate();
+		if (Method() == TrigonometricFunctions::DIRECT)
+			Approximate (exact);
+		else
+			ApproximateFourier (exact);
+
+		// Refit the regression by the robust loss function
+		Robust();
 
 		// Adjust the regression with the connection line we eliminated before
-		approx += trend_line;
+		if (!funcs -> Lean()) approx += trend_line;
 	}
 
 //============================================================================//
@@ -143,15 +579,52 @@ public:
 	TrigonometricRegression (
 		vector <double> x,		// Predictors (independent variables)
 		vector <double> y,		// Response (dependent variables)
-		size_t degree			// Polynomial degree
-	) :	TrigonometricRegression (x.data(), y.data(), min (x.size(), y.size()), degree)
+		size_t degree,			// Polynomial degree
+		bool lean = false,		// Do not store the functions
+		bool exact = false,		// Find the least squares coefficients
+		LossFunction loss = MSE,	// Loss function of the regression
+		bool sorted = false,	// X values are sorted in ascending order
+		FourierMethod method = TrigonometricFunctions::AUTO	// Method to find the sums over the X values
+	) :	TrigonometricRegression (x.data(), y.data(), NULL, min (x.size(), y.size()), degree, lean, exact, loss, sorted, method)
+	{}
+
+	TrigonometricRegression (
+		const pylist &x,		// Predictors (independent variables)
+		const pylist &y,		// Response (dependent variables)
+		size_t degree,			// Polynomial degree
+		bool lean = false,		// Do not store the functions
+		bool exact = false,		// Find the least squares coefficients
+		LossFunction loss = MSE,	// Loss function of the regression
+		bool sorted = false,	// X values are sorted in ascending order
+		FourierMethod method = TrigonometricFunctions::AUTO	// Method to find the sums over the X values
+	) : TrigonometricRegression (to_vector (x), to_vector (y), degree, lean, exact, loss, sorted, method)
+	{}
+
+	// Weighted regression, where the weights are counts of the observations
+	TrigonometricRegression (
+		vector <double> x,		// Predictors (independent variables)
+		vector <double> y,		// Response (dependent variables)
+		vector <double> w,		// Weights of the observations
+		size_t degree,			// Polynomial degree
+		bool lean = false,		// Do not store the functions
+		bool exact = false,		// Find the least squares coefficients
+		LossFunction loss = MSE,	// Loss function of the regression
+		bool sorted = false,	// X values are sorted in ascending order
+		FourierMethod method = TrigonometricFunctions::AUTO	// Method to find the sums over the X values
+	) :	TrigonometricRegression (x.data(), y.data(), w.data(), min ({x.size(), y.size(), w.size()}), degree, lean, exact, loss, sorted, method)
 	{}
 
 	TrigonometricRegression (
 		const pylist &x,		// Predictors (independent variables)
 		const pylist &y,		// Response (dependent variables)
-		size_t degree			// Polynomial degree
-	) : TrigonometricRegression (to_vector (x), to_vector (y), degree)
+		const pylist &w,		// Weights of the observations
+		size_t degree,			// Polynomial degree
+		bool lean = false,		// Do not store the functions
+		bool exact = false,		// Find the least squares coefficients
+		LossFunction loss = MSE,	// Loss function of the regression
+		bool sorted = false,	// X values are sorted in ascending order
+		FourierMethod method = TrigonometricFunctions::AUTO	// Method to find the sums over the X values
+	) : TrigonometricRegression (to_vector (x), to_vector (y), to_vector (w), degree, lean, exact, loss, sorted, method)
 	{}
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
@@ -164,6 +637,47 @@ public:
 		const double shift = funcs -> Convert (x) * coeff;
 		return regression + shift;
 	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Method to find the sums over the X values                             //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	FourierMethod Method (void) const {
+		return Basis() -> Method();
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Name of the method to find the sums over the X values                 //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	string MethodName (void) const {
+		switch (Method())
+		{
+			case TrigonometricFunctions::UNIFORM:
+				return "FFT";
+
+			case TrigonometricFunctions::GRIDDING:
+				return "Gridding";
+
+			default:
+				return "Direct";
+		}
+	}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//      Regression values for the target arguments                            //
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+	virtual void Regression (
+		const double x[],		// Values to calculate the regression for
+		double result[],		// Regression values
+		size_t size				// Number of the values
+	) const override final {
+
+		// Evaluate the orthogonal expansion
+		OrthogonalRegression::Regression (x, result, size);
+
+		// Adjust the regression with the connection line
+		for (size_t i = 0; i < size; i++)
+			result[i] += funcs -> Convert (x[i]) * coeff;
+	}
 };
 
 //****************************************************************************//
@@ -171,7 +685,7 @@ public:
 //****************************************************************************//
 ostream& operator << (ostream &stream, const TrigonometricRegression &object)
 {
-	stream << object.Summary ("Trigonometric regression (MSE)");
+	stream << object.Summary ("Trigonometric regression (" + object.LossName() + ", " + object.MethodName() + ")");
 	return stream;
 }
 /*
@@ -11,6 +11,8 @@
 # include	<boost/python/suite/indexing/vector_indexing_suite.hpp>
 # include	"linear_regression.hpp"
 # include	"trigonometric_regression.hpp"
+# include	"online_regression.hpp"
+# include	"multiple_regression.hpp"
 
 //****************************************************************************//
 //      Methods are inherited from the base class                             //
@@ -35,8 +37,30 @@
 		"Regression coefficients")												\
 	.def ("StdErrCoeffs",	&class::StdErrCoeffs,								\
 		"Standard errors of the regression coefficients")						\
-	.def ("Regression",		&class::Regression,	args ("x"),						\
+	.def ("Regression",		static_cast <double (class::*) (double) const>		\
+		(&class::Regression),	args ("x"),										\
 		"Regression value for the target argument")								\
+	.def ("Regressions",	&class::Regressions,	args ("x"),					\
+		"Regression values for the target arguments")							\
+	.def ("RSSPath",		&class::RSSPath,									\
+		"Residual sums of squares for all the degrees up to the set one")		\
+	.def ("AICPath",		&class::AICPath,									\
+		"Akaike information criterion (AIC) for all the degrees")				\
+	.def ("BICPath",		&class::BICPath,									\
+		"Bayesian information criterion (BIC) for all the degrees")				\
+	.def ("GCVPath",		&class::GCVPath,									\
+		"Generalized cross-validation (GCV) score for all the degrees")			\
+	.def ("FPath",			&class::FPath,										\
+		"F statistics of every degree against the previous one")				\
+	.def ("PValuePath",		&class::PValuePath,									\
+		"P-values of the F-test of every degree against the previous one")		\
+	.def ("BestDegree",		&class::BestDegree,									\
+		(args ("criterion"), args ("alpha") = 0.05),							\
+		"The best regression degree by the criterion")							\
+	.def ("Weights",		&class::Weights,									\
+		"Weights of the observations in the regression")						\
+	.def ("PriorWeights",	&class::PriorWeights,								\
+		"Prior weights of the observations (ones if unweighted)")				\
 	.def (self_ns::str (self_ns::self))
 
 //****************************************************************************//
@@ -72,6 +96,26 @@
 	.add_property ("Functions",				&class::Functions,					\
 		"Count of the orthogonal functions used")
 
+//****************************************************************************//
+//      Properties of the robust regression                                   //
+//****************************************************************************//
+# define	ROBUST_CLASS_PROPERTIES(class) 										\
+	.add_property ("Loss",					&class::Loss,						\
+		"Loss function of the regression")										\
+	.add_property ("Scale",					&class::Scale,						\
+		"Robust scale of the residuals (zero for the MSE regression)")			\
+	.add_property ("Iterations",			&class::Iterations,					\
+		"Count of the reweighting iterations (zero for the MSE regression)")
+
+//****************************************************************************//
+//      Properties of the weighted regression                                 //
+//****************************************************************************//
+# define	WEIGHTED_CLASS_PROPERTIES(class) 									\
+	.add_property ("TotalWeight",			&class::TotalWeight,				\
+		"Total prior weight of the observations (data size if unweighted)")		\
+	.add_property ("Weighted",				&class::Weighted,					\
+		"Check if the observations have the prior weights")
+
 //****************************************************************************//
 //      Python module initialization functions                                //
 //****************************************************************************//
@@ -80,6 +124,24 @@ BOOST_PYTHON_MODULE (regression) {
 	// Use shortenings
 	using namespace boost::python;
 
+//============================================================================//
+//      Expose criteria to select the regression degree to Python             //
+//============================================================================//
+	enum_ <OrthogonalRegression::Criterion> ("Criterion")
+		.value ("AIC",		OrthogonalRegression::AIC)
+		.value ("BIC",		OrthogonalRegression::BIC)
+		.value ("GCV",		OrthogonalRegression::GCV)
+		.value ("FTEST",	OrthogonalRegression::FTEST);
+
+//============================================================================//
+//      Expose loss functions of the regression to Python                     //
+//============================================================================//
+	enum_ <OrthogonalRegression::LossFunction> ("LossFunction")
+		.value ("MSE",		OrthogonalRegression::MSE)
+		.value ("HUBER",	OrthogonalRegression::HUBER)
+		.value ("BISQUARE",	OrthogonalRegression::BISQUARE)
+		.value ("LAD",		OrthogonalRegression::LAD);
+
 //============================================================================//
 //      Expose "LegendreRegression" class to Python                           //
 //============================================================================//
@@ -90,12 +152,56 @@ BOOST_PYTHON_MODULE (regression) {
 		.def (init <vector <double>, vector <double>, size_t>
 			(args ("x", "y", "degree"),
 			"Calculate the Legendre regression over the dataset"))
+		.def (init <const pylist&, const pylist&, size_t, bool>
+			(args ("x", "y", "degree", "lean"),
+			"Calculate the Legendre regression without storing the orthogonal polynomials"))
+		.def (init <const pylist&, const pylist&, size_t, bool, bool>
+			(args ("x", "y", "degree", "lean", "exact"),
+			"Calculate the Legendre regression by the least squares on irregular X values"))
+		.def (init <vector <double>, vector <double>, size_t, bool>
+			(args ("x", "y", "degree", "lean"),
+			"Calculate the Legendre regression without storing the orthogonal polynomials"))
+		.def (init <vector <double>, vector <double>, size_t, bool, bool>
+			(args ("x", "y", "degree", "lean", "exact"),
+			"Calculate the Legendre regression by the least squares on irregular X values"))
+		.def (init <const pylist&, const pylist&, size_t, bool, bool, OrthogonalRegression::LossFunction>
+			(args ("x", "y", "degree", "lean", "exact", "loss"),
+			"Calculate the Legendre regression by the robust loss function"))
+		.def (init <vector <double>, vector <double>, size_t, bool, bool, OrthogonalRegression::LossFunction>
+			(args ("x", "y", "degree", "lean", "exact", "loss"),
+			"Calculate the Legendre regression by the robust loss function"))
+		.def (init <const pylist&, const pylist&, const pylist&, size_t>
+			(args ("x", "y", "w", "degree"),
+			"Calculate the Legendre regression over the weighted dataset"))
+		.def (init <vector <double>, vector <double>, vector <double>, size_t>
+			(args ("x", "y", "w", "degree"),
+			"Calculate the Legendre regression over the weighted dataset"))
+		.def (init <const pylist&, const pylist&, const pylist&, size_t, bool, bool, OrthogonalRegression::LossFunction>
+			(args ("x", "y", "w", "degree", "lean", "exact", "loss"),
+			"Calculate the Legendre regression over the weighted dataset"))
+		.def (init <vector <double>, vector <double>, vector <double>, size_t, bool, bool, OrthogonalRegression::LossFunction>
+			(args ("x", "y", "w", "degree", "lean", "exact", "loss"),
+			"Calculate the Legendre regression over the weighted dataset"))
+		.def (init <const pylist&, const pylist&, size_t, bool, bool, OrthogonalRegression::LossFunction, bool>
+			(args ("x", "y", "degree", "lean", "exact", "loss", "sorted"),
+			"Calculate the Legendre regression over the dataset with sorted X values"))
+		.def (init <vector <double>, vector <double>, size_t, bool, bool, OrthogonalRegression::LossFunction, bool>
+			(args ("x", "y", "degree", "lean", "exact", "loss", "sorted"),
+			"Calculate the Legendre regression over the dataset with sorted X values"))
+		.def (init <const pylist&, const pylist&, const pylist&, size_t, bool, bool, OrthogonalRegression::LossFunction, bool>
+			(args ("x", "y", "w", "degree", "lean", "exact", "loss", "sorted"),
+			"Calculate the Legendre regression over the weighted dataset with sorted X values"))
+		.def (init <vector <double>, vector <double>, vector <double>, size_t, bool, bool, OrthogonalRegression::LossFunction, bool>
+			(args ("x", "y", "w", "degree", "lean", "exact", "loss", "sorted"),
+			"Calculate the Legendre regression over the weighted dataset with sorted X values"))
 
 		// Methods
 		BASE_CLASS_METHODS(LegendreRegression)
 
 		// Properties
-		BASE_CLASS_PROPERTIES(LegendreRegression);
+		BASE_CLASS_PROPERTIES(LegendreRegression)
+		ROBUST_CLASS_PROPERTIES(LegendreRegression)
+		WEIGHTED_CLASS_PROPERTIES(LegendreRegression);
 
 //============================================================================//
 //      Expose "LinearRegression" class to Python                             //
@@ -107,12 +213,53 @@ BOOST_PYTHON_MODULE (regression) {
 		.def (init <vector <double>, vector <double>>
 			(args ("x", "y"),
 			"Calculate the linear regression over the dataset"))
+		.def (init <const pylist&, const pylist&, OrthogonalRegression::LossFunction>
+			(args ("x", "y", "loss"),
+			"Calculate the linear regression by the robust loss function"))
+		.def (init <vector <double>, vector <double>, OrthogonalRegression::LossFunction>
+			(args ("x", "y", "loss"),
+			"Calculate the linear regression by the robust loss function"))
+		.def (init <const pylist&, const pylist&, const pylist&>
+			(args ("x", "y", "w"),
+			"Calculate the linear regression over the weighted dataset"))
+		.def (init <vector <double>, vector <double>, vector <double>>
+			(args ("x", "y", "w"),
+			"Calculate the linear regression over the weighted dataset"))
+		.def (init <const pylist&, const pylist&, const pylist&, OrthogonalRegression::LossFunction>
+			(args ("x", "y", "w", "loss"),
+			"Calculate the linear regression over the weighted dataset"))
+		.def (init <vector <double>, vector <double>, vector <double>, OrthogonalRegression::LossFunction>
+			(args ("x", "y", "w", "loss"),
+			"Calculate the linear regression over the weighted dataset"))
+		.def (init <const pylist&, const pylist&, OrthogonalRegression::LossFunction, bool>
+			(args ("x", "y", "loss", "sorted"),
+			"Calculate the linear regression over the dataset with sorted X values"))
+		.def (init <vector <double>, vector <double>, OrthogonalRegression::LossFunction, bool>
+			(args ("x", "y", "loss", "sorted"),
+			"Calculate the linear regression over the dataset with sorted X values"))
+		.def (init <const pylist&, const pylist&, const pylist&, OrthogonalRegression::LossFunction, bool>
+			(args ("x", "y", "w", "loss", "sorted"),
+			"Calculate the linear regression over the weighted dataset with sorted X values"))
+		.def (init <vector <double>, vector <double>, vector <double>, OrthogonalRegression::LossFunction, bool>
+			(args ("x", "y", "w", "loss", "sorted"),
+			"Calculate the linear regression over the weighted dataset with sorted X values"))
 
 		// Methods
 		BASE_CLASS_METHODS(LinearRegression)
 
 		// Properties
-		BASE_CLASS_PROPERTIES(LinearRegression);
+		BASE_CLASS_PROPERTIES(LinearRegression)
+		ROBUST_CLASS_PROPERTIES(LinearRegression)
+		WEIGHTED_CLASS_PROPERTIES(LinearRegression);
+
+//============================================================================//
+//      Expose methods to find the sums over the X values to Python           //
+//============================================================================//
+	enum_ <TrigonometricFunctions::FourierMethod> ("FourierMethod")
+		.value ("AUTO",		TrigonometricFunctions::AUTO)
+		.value ("DIRECT",	TrigonometricFunctions::DIRECT)
+		.value ("UNIFORM",	TrigonometricFunctions::UNIFORM)
+		.value ("GRIDDING",	TrigonometricFunctions::GRIDDING);
 
 //============================================================================//
 //      Expose "TrigonometricRegression" class to Python                      //
@@ -124,12 +271,191 @@ BOOST_PYTHON_MODULE (regression) {
 		.def (init <vector <double>, vector <double>, size_t>
 			(args ("x", "y", "degree"),
 			"Calculate the trigonometric regression over the dataset"))
+		.def (init <const pylist&, const pylist&, size_t, bool>
+			(args ("x", "y", "degree", "lean"),
+			"Calculate the trigonometric regression without storing the orthogonal functions"))
+		.def (init <const pylist&, const pylist&, size_t, bool, bool>
+			(args ("x", "y", "degree", "lean", "exact"),
+			"Calculate the trigonometric regression by the least squares on irregular X values"))
+		.def (init <vector <double>, vector <double>, size_t, bool>
+			(args ("x", "y", "degree", "lean"),
+			"Calculate the trigonometric regression without storing the orthogonal functions"))
+		.def (init <vector <double>, vector <double>, size_t, bool, bool>
+			(args ("x", "y", "degree", "lean", "exact"),
+			"Calculate the trigonometric regression by the least squares on irregular X values"))
+		.def (init <const pylist&, const pylist&, size_t, bool, bool, OrthogonalRegression::LossFunction>
+			(args ("x", "y", "degree", "lean", "exact", "loss"),
+			"Calculate the trigonometric regression by the robust loss function"))
+		.def (init <vector <double>, vector <double>, size_t, bool, bool, OrthogonalRegression::LossFunction>
+			(args ("x", "y", "degree", "lean", "exact", "loss"),
+			"Calculate the trigonometric regression by the robust loss function"))
+		.def (init <const pylist&, const pylist&, const pylist&, size_t>
+			(args ("x", "y", "w", "degree"),
+			"Calculate the trigonometric regression over the weighted dataset"))
+		.def (init <vector <double>, vector <double>, vector <double>, size_t>
+			(args ("x", "y", "w", "degree"),
+			"Calculate the trigonometric regression over the weighted dataset"))
+		.def (init <const pylist&, const pylist&, const pylist&, size_t, bool, bool, OrthogonalRegression::LossFunction>
+			(args ("x", "y", "w", "degree", "lean", "exact", "loss"),
+			"Calculate the trigonometric regression over the weighted dataset"))
+		.def (init <vector <double>, vector <double>, vector <double>, size_t, bool, bool, OrthogonalRegression::LossFunction>
+			(args ("x", "y", "w", "degree", "lean", "exact", "loss"),
+			"Calculate the trigonometric regression over the weighted dataset"))
+		.def (init <const pylist&, const pylist&, size_t, bool, bool, OrthogonalRegression::LossFunction, bool>
+			(args ("x", "y", "degree", "lean", "exact", "loss", "sorted"),
+			"Calculate the trigonometric regression over the dataset with sorted X values"))
+		.def (init <vector <double>, vector <double>, size_t, bool, bool, OrthogonalRegression::LossFunction, bool>
+			(args ("x", "y", "degree", "lean", "exact", "loss", "sorted"),
+			"Calculate the trigonometric regression over the dataset with sorted X values"))
+		.def (init <const pylist&, const pylist&, const pylist&, size_t, bool, bool, OrthogonalRegression::LossFunction, bool>
+			(args ("x", "y", "w", "degree", "lean", "exact", "loss", "sorted"),
+			"Calculate the trigonometric regression over the weighted dataset with sorted X values"))
+		.def (init <vector <double>, vector <double>, vector <double>, size_t, bool, bool, OrthogonalRegression::LossFunction, bool>
+			(args ("x", "y", "w", "degree", "lean", "exact", "loss", "sorted"),
+			"Calculate the trigonometric regression over the weighted dataset with sorted X values"))
+		.def (init <const pylist&, const pylist&, size_t, bool, bool, OrthogonalRegression::LossFunction, bool, TrigonometricFunctions::FourierMethod>
+			(args ("x", "y", "degree", "lean", "exact", "loss", "sorted", "method"),
+			"Calculate the trigonometric regression by the chosen method to find the sums over the X values"))
+		.def (init <vector <double>, vector <double>, size_t, bool, bool, OrthogonalRegression::LossFunction, bool, TrigonometricFunctions::FourierMethod>
+			(args ("x", "y", "degree", "lean", "exact", "loss", "sorted", "method"),
+			"Calculate the trigonometric regression by the chosen method to find the sums over the X values"))
+		.def (init <const pylist&, const pylist&, const pylist&, size_t, bool, bool, OrthogonalRegression::LossFunction, bool, TrigonometricFunctions::FourierMethod>
+			(args ("x", "y", "w", "degree", "lean", "exact", "loss", "sorted", "method"),
+			"Calculate the trigonometric regression over the weighted dataset by the chosen method"))
+		.def (init <vector <double>, vector <double>, vector <double>, size_t, bool, bool, OrthogonalRegression::LossFunction, bool, TrigonometricFunctions::FourierMethod>
+			(args ("x", "y", "w", "degree", "lean", "exact", "loss", "sorted", "method"),
+			"Calculate the trigonometric regression over the weighted dataset by the chosen method"))
 
 		// Methods
 		BASE_CLASS_METHODS(TrigonometricRegression)
 
 		// Properties
-		BASE_CLASS_PROPERTIES(TrigonometricRegression);
+		.add_property ("Method",				&TrigonometricRegression::Method,
+			"Method to find the sums over the X values")
+		BASE_CLASS_PROPERTIES(TrigonometricRegression)
+		ROBUST_CLASS_PROPERTIES(TrigonometricRegression)
+		WEIGHTED_CLASS_PROPERTIES(TrigonometricRegression);
+
+//============================================================================//
+//      Expose "OnlineRegression" class to Python                             //
+//============================================================================//
+	enum_ <OnlineRegression::BasisType> ("BasisType")
+		.value ("LEGENDRE",			OnlineRegression::LEGENDRE)
+		.value ("TRIGONOMETRIC",	OnlineRegression::TRIGONOMETRIC);
+
+void (OnlineRegression::*OnlineAdd1)(double x, double y)							= &OnlineRegression::Add;
+void (OnlineRegression::*OnlineAdd2)(const vector <double>&, const vector <double>&)	= &OnlineRegression::Add;
+void (OnlineRegression::*OnlineRemove1)(double x, double y)						= &OnlineRegression::Remove;
+void (OnlineRegression::*OnlineRemove2)(const vector <double>&, const vector <double>&)	= &OnlineRegression::Remove;
+	class_ <OnlineRegression> ("OnlineRegression",
+		"Online regression by orthogonal functions over a data stream",
+		init <const Model::Range&, size_t, OnlineRegression::BasisType>
+			(args ("domain", "degree", "basis"),
+			"Create an empty online regression for the domain of X values"))
+		.def (init <const pylist&, const pylist&, size_t, OnlineRegression::BasisType>
+			(args ("x", "y", "degree", "basis"),
+			"Create an online regression over the initial dataset"))
+		.def (init <vector <double>, vector <double>, size_t, OnlineRegression::BasisType>
+			(args ("x", "y", "degree", "basis"),
+			"Create an online regression over the initial dataset"))
+
+		// Methods
+		.def ("Domain",			&OnlineRegression::Domain,
+			return_internal_reference <> (),
+			"Range of X values the regression accepts")
+		.def ("Add",			OnlineAdd1,		args ("x", "y"),
+			"Add a point to the dataset")
+		.def ("Add",			OnlineAdd2,		args ("x", "y"),
+			"Add points to the dataset")
+		.def ("Remove",			OnlineRemove1,	args ("x", "y"),
+			"Remove a point from the dataset")
+		.def ("Remove",			OnlineRemove2,	args ("x", "y"),
+			"Remove points from the dataset")
+		.def ("Slide",			&OnlineRegression::Slide,
+			args ("x", "y", "old_x", "old_y"),
+			"Slide the data window: add a new point and remove the oldest one")
+		.def ("Coeffs",			&OnlineRegression::Coeffs,
+			"Regression coefficients")
+		.def ("StdErrCoeffs",	&OnlineRegression::StdErrCoeffs,
+			"Standard errors of the regression coefficients")
+		.def ("Regression",		&OnlineRegression::Regression,	args ("x"),
+			"Regression value for the target argument")
+		.def (self_ns::str (self_ns::self))
+
+		// Properties
+		BASE_CLASS_PROPERTIES(OnlineRegression)
+		.add_property ("Basis",	&OnlineRegression::Basis,
+			"Orthogonal functions type");
+
+//============================================================================//
+//      Expose "MultipleRegression" class to Python                           //
+//============================================================================//
+	enum_ <MultipleRegression::SolverType> ("SolverType")
+		.value ("CHOLESKY",		MultipleRegression::CHOLESKY)
+		.value ("QR",			MultipleRegression::QR);
+
+	class_ <MultipleRegression> ("MultipleRegression",
+		"Multiple linear regression by several predictors",
+		init <const pylist&, const pylist&> (args ("x", "y"),
+			"Calculate the regression over the columns of the predictors"))
+		.def (init <const pylist&, const pylist&, MultipleRegression::SolverType>
+			(args ("x", "y", "solver"),
+			"Calculate the regression over the columns of the predictors"))
+		.def (init <vector <double>, vector <double>, size_t>
+			(args ("x", "y", "features"),
+			"Calculate the regression over the predictors stored by columns"))
+		.def (init <vector <double>, vector <double>, size_t, MultipleRegression::SolverType>
+			(args ("x", "y", "features", "solver"),
+			"Calculate the regression over the predictors stored by columns"))
+
+		// Methods
+		.def ("Y",				&MultipleRegression::Y,
+			"Response (dependent variables)")
+		.def ("Approx",			&MultipleRegression::Approx,
+			"Regression approximation")
+		.def ("Residuals",		&MultipleRegression::Residuals,
+			"Regression residuals")
+		.def ("Coeffs",			&MultipleRegression::Coeffs,
+			"Regression coefficients")
+		.def ("StdErrCoeffs",	&MultipleRegression::StdErrCoeffs,
+			"Standard errors of the regression coefficients")
+		.def ("Regression",		&MultipleRegression::Regression,	args ("x"),
+			"Regression value for the target predictors")
+		.def ("Regressions",	&MultipleRegression::Regressions,	args ("x"),
+			"Regression values for the target predictors stored by columns")
+		.def (self_ns::str (self_ns::self))
+
+		// Properties
+		.add_property ("TSS",					&MultipleRegression::TSS,
+			"Total sum of squares (TSS)")
+		.add_property ("RSS",					&MultipleRegression::RSS,
+			"Residual sum of squares (RSS)")
+		.add_property ("ESS",					&MultipleRegression::ESS,
+			"Explained sum of squares (ESS)")
+		.add_property ("MSE_TSS",				&MultipleRegression::MSE_TSS,
+			"Mean square error (MSE) of total sum of squares (TSS)")
+		.add_property ("MSE_RSS",				&MultipleRegression::MSE_RSS,
+			"Mean square error (MSE) of residual sum of squares (RSS)")
+		.add_property ("MSE_ESS",				&MultipleRegression::MSE_ESS,
+			"Mean square error (MSE) of explained sum of squares (ESS)")
+		.add_property ("ExplainedVarFrac",		&MultipleRegression::ExplainedVarFrac,
+			"Fraction of variance explained")
+		.add_property ("UnexplainedVarFrac",	&MultipleRegression::UnexplainedVarFrac,
+			"Fraction of variance unexplained")
+		.add_property ("Determination",			&MultipleRegression::Determination,
+			"Coefficient of determination")
+		.add_property ("AdjustedDetermination",	&MultipleRegression::AdjustedDetermination,
+			"Adjusted coefficient of determination")
+		.add_property ("Correlation",			&MultipleRegression::Correlation,
+			"Coefficient of correlation")
+		.add_property ("StdErrCorrelation",		&MultipleRegression::StdErrCorrelation,
+			"Standard error of the coefficient of correlation")
+		.add_property ("Size",					&MultipleRegression::Size,
+			"Data size")
+		.add_property ("Features",				&MultipleRegression::Features,
+			"Count of the predictors")
+		.add_property ("Solver",				&MultipleRegression::Solver,
+			"Least squares solver type");
 }
 /*
 ################################################################################
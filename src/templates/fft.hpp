@@ -0,0 +1,176 @@
+/*
+################################################################################
+# Encoding: UTF-8                                                  Tab size: 4 #
+#                                                                              #
+#                         FAST FOURIER TRANSFORM (FFT)                         #
+#                                                                              #
+# Ordnung muss sein!                             Copyleft (Ɔ) Eugene Zamlinsky #
+################################################################################
+*/
+# pragma	once
+# include	<cmath>
+# include	<vector>
+# include	<complex>
+
+// Count of butterflies between the powers of the root of unity found directly
+# define	FFT_ROOTS_STEP	32
+
+// Use shortenings
+using namespace std;
+
+namespace FFT
+{
+//****************************************************************************//
+//      The smallest power of two that is greater than or equal to the size   //
+//****************************************************************************//
+inline size_t PowerOfTwo (
+	size_t size						// Required size
+){
+	size_t result = 1;
+	while (result < size) result <<= 1;
+	return result;
+}
+
+//****************************************************************************//
+//      In-place radix-2 transform of the data                                //
+//****************************************************************************//
+// NOTE:	The data size must be a power of two. The inverse transform is
+//			not scaled, so divide the result by the data size
+template <typename T>
+void Transform (
+	vector <complex <T>> &data,		// Data to transform
+	bool inverse					// Inverse transform flag
+){
+	// Reorder the data in the bit reversed order
+	const size_t size = data.size();
+	for (size_t i = 1, j = 0; i < size; i++) {
+		size_t bit = size >> 1;
+		for (; j & bit; bit >>= 1)
+			j ^= bit;
+		j ^= bit;
+		if (i < j) swap (data [i], data [j]);
+	}
+
+	// Butterfly passes
+	const T sign = inverse ? +1 : -1;
+	for (size_t len = 2; len <= size; len <<= 1) {
+
+		// Root of unity for this pass
+		const T angle = sign * 2 * M_PI / len;
+		const complex <T> root (cos (angle), sin (angle));
+
+		// Every FFT_ROOTS_STEP-th power of the root is found directly, so
+		// the rounding errors do not accumulate along the butterflies
+		const size_t half = len >> 1;
+		vector <complex <T>> anchors ((half + FFT_ROOTS_STEP - 1) / FFT_ROOTS_STEP);
+		for (size_t m = 0; m < anchors.size(); m++) {
+			const T phase = angle * T (m * FFT_ROOTS_STEP);
+			anchors [m] = complex <T> (cos (phase), sin (phase));
+		}
+
+		// Combine the halves of every block
+		for (size_t i = 0; i < size; i += len) {
+			for (size_t m = 0; m < anchors.size(); m++) {
+				complex <T> w = anchors [m];
+				const size_t end = min ((m + 1) * FFT_ROOTS_STEP, half);
+				for (size_t j = m * FFT_ROOTS_STEP; j < end; j++) {
+					const complex <T> u = data [i + j];
+					const complex <T> v = data [i + j + half] * w;
+					data [i + j] = u + v;
+					data [i + j + half] = u - v;
+					w *= root;
+				}
+			}
+		}
+	}
+}
+
+//****************************************************************************//
+//      In-place transform of the data of any size                            //
+//****************************************************************************//
+// INFO:	The sizes other than the powers of two are transformed by the
+//			Bluestein algorithm. The product "k * n" in the exponent is
+//			replaced by "(k^2 + n^2 - (k - n)^2) / 2", which turns the
+//			transform into the convolution with the chirp sequence. The
+//			convolution is done by the radix-2 transforms of at least the
+//			doubled size. The inverse transform is not scaled
+template <typename T>
+void DFT (
+	vector <complex <T>> &data,		// Data to transform
+	bool inverse					// Inverse transform flag
+){
+	// The powers of two are transformed directly
+	const size_t size = data.size();
+	if (size == PowerOfTwo (size)) {
+		Transform (data, inverse);
+		return;
+	}
+
+	// Chirp sequence. The squares are reduced modulo the period of the
+	// exponent to keep the angles accurate
+	const T sign = inverse ? +1 : -1;
+	vector <complex <T>> chirp (size);
+	for (size_t n = 0; n < size; n++) {
+		const T angle = sign * M_PI * ((n * n) % (2 * size)) / size;
+		chirp [n] = complex <T> (cos (angle), sin (angle));
+	}
+
+	// The data multiplied by the chirp and the conjugate chirp with the
+	// negative indices wrapped around
+	const size_t length = PowerOfTwo (2 * size - 1);
+	vector <complex <T>> a (length), b (length);
+	for (size_t n = 0; n < size; n++)
+		a [n] = data [n] * chirp [n];
+	b [0] = conj (chirp [0]);
+	for (size_t n = 1; n < size; n++)
+		b [n] = b [length - n] = conj (chirp [n]);
+
+	// Convolve them and multiply the result by the chirp again
+	Transform (a, false);
+	Transform (b, false);
+	for (size_t i = 0; i < length; i++)
+		a [i] *= b [i];
+	Transform (a, true);
+	for (size_t k = 0; k < size; k++)
+		data [k] = chirp [k] * a [k] / T (length);
+}
+
+//****************************************************************************//
+//      Linear convolution of two real sequences                              //
+//****************************************************************************//
+template <typename T>
+vector <T> Convolve (
+	const vector <T> &a,			// The first sequence
+	const vector <T> &b				// The second sequence
+){
+	// Check if the sequences are not empty
+	if (a.empty() || b.empty())
+		return vector <T> ();
+
+	// Pad both sequences with zeros up to the power of two
+	const size_t count = a.size() + b.size() - 1;
+	const size_t size = PowerOfTwo (count);
+	vector <complex <T>> fa (a.begin(), a.end());
+	vector <complex <T>> fb (b.begin(), b.end());
+	fa.resize (size);
+	fb.resize (size);
+
+	// Multiply the spectra of the sequences
+	Transform (fa, false);
+	Transform (fb, false);
+	for (size_t i = 0; i < size; i++)
+		fa [i] *= fb [i];
+	Transform (fa, true);
+
+	// Return the real part of the scaled inverse transform
+	vector <T> result (count);
+	for (size_t i = 0; i < count; i++)
+		result [i] = fa [i].real() / size;
+	return result;
+}
+}
+/*
+################################################################################
+#                                 END OF FILE                                  #
+################################################################################
+*/
@@ -429,6 +429,10 @@ public:
 	const T* Data (void) const {
 		return data;
 	}
+
+	T* Data (void) {
+		return data;
+	}
 };
 }
 /*
@@ -201,6 +201,38 @@ BOOST_PYTHON_MODULE (gui) {
 	def ("show", AsymmetricLaplaceShow1, "Show a GUI window with a summary for the Asymmetric Laplace distribution");
 	def ("show", AsymmetricLaplaceShow2, "Show a GUI window with a summary for the Asymmetric Laplace distribution and a custom title");
 
+//============================================================================//
+//      Expose "Show" functions for the "NormalMixture" object                //
+//============================================================================//
+	void (*NormalMixtureShow1)(const Model::NormalMixture &model)						= &Show;
+	void (*NormalMixtureShow2)(const string &name, const Model::NormalMixture &model)	= &Show;
+	def ("show", NormalMixtureShow1, "Show a GUI window with a summary for the mixture of two Normal distributions");
+	def ("show", NormalMixtureShow2, "Show a GUI window with a summary for the mixture of two Normal distributions and a custom title");
+
+//============================================================================//
+//      Expose "Show" functions for the "GammaMixture" object                 //
+//============================================================================//
+	void (*GammaMixtureShow1)(const Model::GammaMixture &model)						= &Show;
+	void (*GammaMixtureShow2)(const string &name, const Model::GammaMixture &model)	= &Show;
+	def ("show", GammaMixtureShow1, "Show a GUI window with a summary for the mixture of two Gamma distributions");
+	def ("show", GammaMixtureShow2, "Show a GUI window with a summary for the mixture of two Gamma distributions and a custom title");
+
+//============================================================================//
+//      Expose "Show" functions for the "LaplaceMixture" object               //
+//============================================================================//
+	void (*LaplaceMixtureShow1)(const Model::LaplaceMixture &model)						= &Show;
+	void (*LaplaceMixtureShow2)(const string &name, const Model::LaplaceMixture &model)	= &Show;
+	def ("show", LaplaceMixtureShow1, "Show a GUI window with a summary for the mixture of two Laplace distributions");
+	def ("show", LaplaceMixtureShow2, "Show a GUI window with a summary for the mixture of two Laplace distributions and a custom title");
+
+//============================================================================//
+//      Expose "Show" functions for the "LogisticMixture" object              //
+//============================================================================//
+	void (*LogisticMixtureShow1)(const Model::LogisticMixture &model)						= &Show;
+	void (*LogisticMixtureShow2)(const string &name, const Model::LogisticMixture &model)	= &Show;
+	def ("show", LogisticMixtureShow1, "Show a GUI window with a summary for the mixture of two Logistic distributions");
+	def ("show", LogisticMixtureShow2, "Show a GUI window with a summary for the mixture of two Logistic distributions and a custom title");
+
 //============================================================================//
 //      Expose "Show" functions for the "Population" object                   //
 //============================================================================//